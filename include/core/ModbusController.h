@@ -14,51 +14,183 @@
 
 #include <QObject>
 #include <QTimer>
+#include <QHash>
+#include <QMap>
+#include <QtMath>
+#include <QElapsedTimer>
+#include <limits>
 #include <QtGlobal>
 #include "utils/ModbusTag.h"
+#include "utils/ModbusRtuParser.h"
+#include "utils/ModbusUtils.h"
+#include "utils/ModbusRttHistogram.h"
+#include "utils/ModbusTransactionLog.h"
+#include <QDateTime>
 #include "core/SerialPortManager.h"
+#include "core/TcpNetworkManager.h"
+
+// 单个从站的链路统计
+struct ModbusSlaveLinkStatistics
+{
+    int slaveId = 0;
+    quint32 sampleCount = 0;
+    double p50 = 0.0; // 扣除线路时间后的响应延迟分位数(ms)
+    double p99 = 0.0;
+    int timeoutMargin = 0; // 超时时间中线路时间之外的余量(ms)
+    bool isOnline = true;
+    quint64 timeoutCount = 0;
+    quint64 retryCount = 0;
+};
 
 class ModbusController : public QObject
 {
     Q_OBJECT
 
 public:
+    // 传输方式
+    enum class Transport
+    {
+        Rtu, // 串口RTU，同一时刻只有一个请求在途
+        Tcp // Modbus TCP客户端，按MBAP事务号匹配响应，允许多个请求同时在途
+    };
+    Q_ENUM(Transport)
+
     explicit ModbusController(SerialPortManager* serialPortManager, QObject* parent = nullptr);
     ~ModbusController() = default;
-    // ui 公共接口
-    void readHoldingRegister(int slaveId, int startAddress, int quantity);
-    void writeSingleRegister(int slaveId, int startAddress, quint16 value);
-    void writeMultipleRegisters(int slaveId, int startAddress, const QList<quint16>& values);
+    // ui 公共接口，返回请求编号，发送失败返回-1
+    // functionCode为01读线圈、02读离散输入、03读保持寄存器、04读输入寄存器
+    int read(int slaveId, int functionCode, int startAddress, int quantity);
+    int readHoldingRegister(int slaveId, int startAddress, int quantity);
+    int writeSingleCoil(int slaveId, int address, bool value);
+    int writeMultipleCoils(int slaveId, int startAddress, const QList<bool>& values);
+    int writeSingleRegister(int slaveId, int startAddress, quint16 value);
+    int writeMultipleRegisters(int slaveId, int startAddress, const QList<quint16>& values);
+    // 0x17 先写入再读取，一次往返完成设定值下发和回读
+    int readWriteMultipleRegisters(int slaveId, int readAddress, int readQuantity, int writeAddress,
+                                   const QList<quint16>& values);
+    // 切换传输方式会丢弃所有在途请求
+    void setTransport(Transport transport);
+    Transport getTransport() const;
+    // Modbus TCP下同时在途的请求数上限，RTU固定为1
+    void setMaxInFlight(int count);
+    int getMaxInFlight() const;
+    bool canSendRequest() const;
+    // 超时后重发的次数上限，不含首次发送
+    void setMaxRetries(int count);
+    int getMaxRetries() const;
+    // 连续多次请求失败的从站视为离线，收到任何响应后恢复
+    bool isSlaveOnline(int slaveId) const;
+    // 当前传输方式的链路是否可用(串口已打开或网络客户端已连接)
+    bool isTransportOpen() const;
+    QList<ModbusSlaveLinkStatistics> getSlaveStatistics() const;
+    // 被动模式下不发送请求，也不解析串口数据，供总线监听时使用
+    void setPassive(bool passive);
+    bool isPassive() const;
 
 signals:
-    void dataReady(int startAddress, const QList<quint16>& values);
+    // 位读取的每个值为0或1；0x17的回读数据按0x03上报
+    void dataReady(int requestId, int functionCode, int startAddress, const QList<quint16>& values);
     void errorOccurred(const QString& errorString);
     void writeSuccessful(int functionCode, int address);
+    // 一次请求结束(收到响应、异常响应或超时)，轮询调度器据此立即发出下一个请求
+    void requestCompleted(int requestId, bool success);
+    // 读请求从发出到收到响应的耗时(ms)，供请求规划器估计从站的响应延迟
+    void responseTimeMeasured(int slaveId, int functionCode, int quantity, double elapsed);
+    void exceptionReceived(int slaveId, int functionCode, int address, int quantity, int exceptionCode);
+    void slaveStatusChanged(int slaveId, bool online);
+    // 每次请求尝试结束时发出，附带原始请求帧和响应帧
+    void transactionLogged(const ModbusTransactionRecord& record);
 
 private slots:
     void onDataReceived(const QByteArray& data);
+    void onTcpDataReceived(const QByteArray& data);
     void onResponseTimeout();
 
 private:
+    // 在途请求，RTU下以0为键，TCP下以MBAP事务号为键
+    struct Transaction
+    {
+        int requestId = -1;
+        int slaveId = -1;
+        int functionCode = -1;
+        int address = -1;
+        int quantity = -1;
+        int writeAddress = -1; // 仅0x17使用
+        qint64 deadline = 0;
+        qint64 sentAt = 0; // 发出时间(ns)
+        double wireTime = 0.0; // 请求和响应在线路上的传输时间(ms)
+        int attempt = 0; // 已重发次数
+        QByteArray pdu; // 超时重发时使用
+        QByteArray frame; // 最近一次发出的完整帧，用于事务记录
+    };
+
+    // 从站链路状态
+    struct SlaveLink
+    {
+        ModbusRttHistogram turnaround; // 扣除线路时间后的响应延迟
+        int consecutiveFailures = 0;
+        bool isOnline = true;
+        quint64 timeoutCount = 0;
+        quint64 retryCount = 0;
+    };
+
     void connectSignals();
-    QByteArray buildReadRequest(int slaveId, int startAddress, int quantity);
-    QByteArray buildWriteSingleRequest(int slaveId, int address, quint16 value);
-    QByteArray buildWriteMultipleRegisters(int slaveId, int startAddress, const QList<quint16>& values);
+    bool isTransportReady();
+    int sendRequest(Transaction transaction, const QByteArray& pdu);
+    void transmit(Transaction transaction);
+    double wireTime(const Transaction& transaction) const;
+    // 按帧长、波特率和该从站响应延迟的分位数计算超时时间(ms)
+    int responseTimeout(const Transaction& transaction) const;
+    int timeoutMargin(const SlaveLink& link) const;
+    void recordResponse(const Transaction& transaction);
+    void recordFailure(int slaveId);
+    // finishedAt为结束时间(ns，m_clock计时)；isFinal为false表示请求仍在等待响应
+    void logTransaction(const Transaction& transaction, ModbusTransactionRecord::Result result, qint64 finishedAt,
+                        const QByteArray& response = QByteArray(), int exceptionCode = 0, bool isFinal = true);
+    static Transaction makeTransaction(int slaveId, int functionCode, int address, int quantity);
+    QByteArray buildReadPdu(int functionCode, int startAddress, int quantity);
+    QByteArray buildWriteSingleCoilPdu(int address, bool value);
+    QByteArray buildWriteMultipleCoilsPdu(int startAddress, const QList<bool>& values);
+    QByteArray buildWriteSinglePdu(int address, quint16 value);
+    QByteArray buildWriteMultiplePdu(int startAddress, const QList<quint16>& values);
+    QByteArray buildReadWriteMultiplePdu(int readAddress, int readQuantity, int writeAddress,
+                                         const QList<quint16>& values);
+    QByteArray buildRtuFrame(int slaveId, const QByteArray& pdu);
+    QByteArray buildTcpFrame(quint16 transactionId, int slaveId, const QByteArray& pdu);
     void tryParseBuffer();
-    bool processFrame(const QByteArray &frame);
-    void handleReadResponse(const QByteArray &frame);
-    void handleWriteResponse(const QByteArray &frame);
-    void handleExceptionResponse(const QByteArray &frame);
-    quint16 calculateCrc(const QByteArray& data);
+    void tryParseTcpBuffer();
+    // frame为线路上的完整响应帧，只用于事务记录
+    void processPdu(quint16 transactionId, const QByteArray& pdu, const QByteArray& frame);
+    bool handleReadResponse(const Transaction& transaction, const QByteArray& pdu);
+    bool handleWriteResponse(const Transaction& transaction, const QByteArray& pdu);
+    void handleExceptionResponse(const Transaction& transaction, const QByteArray& pdu);
+    void restartResponseTimer();
+
+    static constexpr int RESPONSE_TIMEOUT = 1000; // 样本不足时线路时间之外的超时余量(ms)
+    static constexpr quint32 MIN_RTT_SAMPLES = 20; // 样本数达到后按分位数计算超时
+    static constexpr double TIMEOUT_PERCENTILE = 0.99;
+    static constexpr double TIMEOUT_PERCENTILE_FACTOR = 2.0; // 超时余量至少为p99的倍数
+    static constexpr int MIN_TIMEOUT_MARGIN = 20; // 超时余量的下限和上限(ms)
+    static constexpr int MAX_TIMEOUT_MARGIN = 3000;
+    static constexpr int MAX_RETRIES = 5;
+    static constexpr int OFFLINE_THRESHOLD = 3; // 连续失败的请求数达到后视为离线
+    static constexpr int MAX_IN_FLIGHT = 16;
+    static constexpr int MBAP_HEADER_SIZE = 7;
 
     SerialPortManager* m_pSerialPortManager = nullptr;
-    QByteArray m_buffer;
-    QTimer* m_pResponseTimer; // 响应超时定时器
-    // 记住上一个请求的状态，用于验证响应
-    int m_lastRequestSlaveId = -1;
-    int m_lastRequestFuncCode = -1;
-    int m_lastRequestAddress = -1;
-    int m_lastRequestQuantity = -1;
+    TcpNetworkManager* m_pTcpNetworkManager = nullptr;
+    QByteArray m_buffer; // Modbus TCP接收缓存
+    ModbusRtuParser m_rtuParser;
+    QTimer* m_pResponseTimer; // 响应超时定时器，总是对准最早到期的在途请求
+    QElapsedTimer m_clock;
+    QHash<quint16, Transaction> m_transactions;
+    QMap<int, SlaveLink> m_slaveLinks;
+    Transport m_transport = Transport::Rtu;
+    int m_maxInFlight = 4;
+    int m_maxRetries = 1;
+    bool m_passive = false;
+    quint16 m_nextTransactionId = 0;
+    int m_nextRequestId = 0;
 };
 
 #endif //MODBUSCONTROLLER_H
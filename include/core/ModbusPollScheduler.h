@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusPollScheduler.h
+  * @author         : wangxiangyu
+  * @brief          : Modbus轮询调度器，请求完成后立即发出下一个到期的请求
+  * @attention      : 扫描组按优先级和到期时间调度，高优先级组可以插入到低优先级组的扫描周期中间；
+  *                   Modbus TCP下按控制器的在途窗口同时发出多个请求
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MODBUSPOLLSCHEDULER_H
+#define MODBUSPOLLSCHEDULER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QList>
+#include <QHash>
+#include <limits>
+#include "core/ModbusController.h"
+#include "utils/ModbusUtils.h"
+
+struct ModbusReadRequest
+{
+    int slaveId;
+    int startAddress; // 协议地址 (从0开始)
+    int quantity;
+    int functionCode = 0x03; // 01/02/03/04
+    QVector<ModbusDecodeEntry> decodePlan; // 响应中包含的点位，收到数据后只需遍历这些点位
+};
+
+// 扫描组：扫描周期和优先级相同的点位合并后的读请求
+struct ModbusScanGroup
+{
+    int interval = 1000; // 扫描周期(ms)
+    int priority = 0; // 数值越大越优先
+    QList<ModbusReadRequest> requests;
+};
+
+struct ModbusScanGroupStatistics
+{
+    int interval = 0;
+    int priority = 0;
+    int requestCount = 0;
+    double achievedRate = 0.0; // 实际每秒完成的扫描周期数
+};
+
+class ModbusPollScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    // 离线从站的探测间隔(ms)：期间跳过发往该从站的请求，到期后只发一个请求探测
+    static constexpr int PROBE_INTERVAL = 5000;
+
+    // 构造函数和析构函数
+    explicit ModbusPollScheduler(ModbusController* controller, QObject* parent = nullptr);
+    ~ModbusPollScheduler() = default;
+
+    void setScanGroups(const QList<ModbusScanGroup>& groups);
+    void start();
+    void stop();
+    bool isRunning() const;
+    QList<ModbusScanGroupStatistics> getStatistics() const;
+
+signals:
+    void statisticsUpdated(const QList<ModbusScanGroupStatistics>& statistics);
+    // 本调度器发出的读请求收到数据，携带请求本身以便按其解码步骤解码
+    void responseReady(const ModbusReadRequest& request, const QList<quint16>& values);
+
+private slots:
+    void onDataReady(int requestId, int functionCode, int startAddress, const QList<quint16>& values);
+    void onRequestCompleted(int requestId, bool success);
+    void onStatisticsTimeout();
+    void dispatchNext();
+
+private:
+    // 已发出、尚未完成的请求所属的扫描组和组内下标
+    struct PendingRequest
+    {
+        int group = -1;
+        int request = -1;
+    };
+
+    // 扫描组运行状态
+    struct GroupState
+    {
+        ModbusScanGroup group;
+        qint64 nextDue = 0; // 下一个扫描周期的开始时间
+        qint64 cycleStart = 0;
+        int nextRequest = 0; // 当前周期中下一个要发送的请求
+        int inFlight = 0; // 当前周期中已发出、尚未完成的请求数
+        int completedCycles = 0; // 统计窗口内完成的周期数
+        double achievedRate = 0.0;
+    };
+
+    // 私有方法
+    int selectGroup(qint64 now) const;
+    // 组内一个请求完成或被跳过，所有请求都已结束时完成本周期
+    void finishRequest(GroupState& state);
+    void scheduleDispatch();
+
+    // 静态成员变量
+    static constexpr int STATISTICS_INTERVAL = 1000;
+    static constexpr int RETRY_INTERVAL = 100; // 请求发送失败后的重试间隔(ms)
+
+    // 核心数据成员
+    ModbusController* m_pController = nullptr;
+    QTimer* m_pWakeTimer = nullptr; // 没有到期的扫描组时等待最近的到期时间
+    QTimer* m_pStatisticsTimer = nullptr;
+    QList<GroupState> m_groups;
+    QHash<int, PendingRequest> m_pendingRequests; // 请求编号 -> 请求位置
+    QHash<int, qint64> m_nextProbe; // 离线从站 -> 下一次探测时间
+    QElapsedTimer m_clock;
+    QElapsedTimer m_statisticsClock;
+
+    // 状态变量
+    bool m_isRunning = false;
+    bool m_dispatchPending = false;
+};
+
+#endif //MODBUSPOLLSCHEDULER_H
@@ -0,0 +1,96 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusRequestPlanner.h
+  * @author         : wangxiangyu
+  * @brief          : 基于代价模型的Modbus读请求规划器
+  * @attention      : 按波特率和字符帧格式估算线路时间，运行时测量各从站的响应延迟，
+  *                   从异常响应中学习非法地址空洞和地址非法的点位，用动态规划选出总扫描时间最短的请求组合
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MODBUSREQUESTPLANNER_H
+#define MODBUSREQUESTPLANNER_H
+
+#include <QObject>
+#include <QHash>
+#include <QList>
+#include <QVector>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QSerialPort>
+#include "core/ModbusController.h"
+#include "core/ModbusPollScheduler.h"
+#include "utils/ModbusUtils.h"
+
+class ModbusRequestPlanner : public QObject
+{
+    Q_OBJECT
+
+public:
+    // 构造函数和析构函数
+    explicit ModbusRequestPlanner(ModbusController* controller, QObject* parent = nullptr);
+    ~ModbusRequestPlanner() = default;
+
+    // 为tagIndices中的点位生成读请求及其解码步骤，estimatedTime返回一个扫描周期的预计耗时(ms)
+    QList<ModbusReadRequest> plan(const QList<ModbusTag>& tags, const QList<int>& tagIndices,
+                                  double* estimatedTime = nullptr);
+    // 清除测量结果和学习到的非法地址，用于切换链路或从站配置变化后
+    void reset();
+    // 单个读请求的预计耗时(ms)
+    double estimateRequestTime(int slaveId, int functionCode, int quantity) const;
+
+signals:
+    // 测量结果与规划时的假设偏差较大或发现新的非法地址，需要重新规划
+    void planInvalidated();
+
+private slots:
+    void onResponseTimeMeasured(int slaveId, int functionCode, int quantity, double elapsed);
+    void onExceptionReceived(int slaveId, int functionCode, int address, int quantity, int exceptionCode);
+
+private:
+    // 待规划的点位，地址为协议地址
+    struct PlanItem
+    {
+        int tagIndex;
+        int slaveId;
+        int functionCode;
+        int start;
+        int end; // 不含
+    };
+
+    // 私有方法
+    void updateLinkModel();
+    double wireTime(int functionCode, int quantity) const;
+    double turnaround(int slaveId) const;
+    void planSegment(const QVector<PlanItem>& items, const QList<ModbusTag>& tags, QList<ModbusReadRequest>& requests,
+                     double& totalTime);
+    // 根据学习到的非法地址区间，求出不能跨越的空洞地址和只能单独读取的点位
+    void collectConstraints(int slaveId, int functionCode, const QVector<PlanItem>& items, QVector<int>& holes,
+                            QVector<bool>& isolated) const;
+    void requestReplan();
+    static quint32 areaKey(int slaveId, int functionCode);
+
+    // 静态成员变量
+    static constexpr double DEFAULT_RTU_TURNAROUND = 5.0; // 未测量前假设的从站响应延迟(ms)
+    static constexpr double DEFAULT_TCP_TURNAROUND = 2.0;
+    static constexpr double TCP_BYTE_TIME = 0.0001; // 以太网上每字节的时间可以忽略
+    static constexpr double SMOOTHING_FACTOR = 0.2; // 响应延迟的指数平滑系数
+    static constexpr double REPLAN_THRESHOLD = 0.25; // 响应延迟偏离规划值超过该比例时重新规划
+    static constexpr int MIN_REPLAN_INTERVAL = 5000; // 两次重新规划的最小间隔(ms)
+
+    // 核心数据成员
+    ModbusController* m_pController = nullptr;
+    QHash<int, double> m_turnaround; // 从站 -> 平滑后的响应延迟(ms)
+    QHash<int, double> m_plannedTurnaround; // 上次规划使用的响应延迟
+    QHash<quint32, QList<QPair<int, int>>> m_illegalRanges; // (从站,功能码) -> 返回过非法地址异常的区间
+
+    // 状态变量
+    bool m_isTcp = false;
+    double m_byteTime = 0.0; // 每字节线路时间(ms)
+    double m_frameGap = 0.0; // RTU帧间静默时间(ms)
+    bool m_replanPending = false;
+    QElapsedTimer m_lastPlanTimer;
+};
+
+#endif //MODBUSREQUESTPLANNER_H
@@ -0,0 +1,97 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusRtuSniffer.h
+  * @author         : wangxiangyu
+  * @brief          : 被动监听RS-485总线，从原始字节流中同时识别请求帧和响应帧并配对为事务
+  * @attention      : 帧边界由帧长、CRC校验和帧间静默共同确定；读缓冲只移动游标，
+  *                   已消费的数据累积到阈值后才压缩，解析开销与总线数据量成线性关系
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MODBUSRTUSNIFFER_H
+#define MODBUSRTUSNIFFER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QDateTime>
+#include <chrono>
+#include "utils/ModbusRtuParser.h"
+#include "utils/ModbusCrc.h"
+#include "utils/ModbusUtils.h"
+#include "utils/ModbusTransactionLog.h"
+#include "core/SerialPortManager.h"
+
+class ModbusRtuSniffer : public QObject
+{
+    Q_OBJECT
+
+public:
+    // 构造函数和析构函数
+    explicit ModbusRtuSniffer(SerialPortManager* serialPortManager, QObject* parent = nullptr);
+    ~ModbusRtuSniffer() = default;
+
+    void start();
+    void stop();
+    bool isRunning() const;
+    // 自start()起识别出的帧数和为重新同步而丢弃的字节数
+    quint64 getFrameCount() const;
+    quint64 getDiscardedBytes() const;
+
+signals:
+    // 一次事务确认后观察到的数据区的值：读取为响应中的值，写入为请求中的值；
+    // functionCode为值所在数据区对应的读功能码(01/02/03/04)
+    void valuesObserved(int slaveId, int functionCode, int startAddress, const QList<quint16>& values);
+    void transactionLogged(const ModbusTransactionRecord& record);
+
+private slots:
+    void onDataReceived(const QByteArray& data, qint64 timestamp);
+    void onResponseTimeout();
+
+private:
+    // 等待响应的请求
+    struct PendingRequest
+    {
+        bool isValid = false;
+        int slaveId = 0;
+        int functionCode = 0;
+        int address = 0;
+        int quantity = 0;
+        QByteArray frame;
+        qint64 timestamp = 0; // 请求所在数据块的到达时间(ns)
+    };
+
+    // 私有方法
+    void parseBuffer(qint64 timestamp);
+    // 尝试在当前位置按请求(isRequest)或响应识别一帧：>0为帧长，0为数据不足，-1为不是该类帧
+    int matchFrame(bool isRequest) const;
+    void handleRequest(const QByteArray& frame, qint64 timestamp);
+    void handleResponse(const QByteArray& frame, qint64 timestamp);
+    void emitWrittenValues(const QByteArray& request);
+    void finishPending(ModbusTransactionRecord::Result result, const QByteArray& response, qint64 timestamp,
+                       int exceptionCode = 0);
+    void compact();
+    static qint64 now();
+    static int readUInt16(const char* data);
+
+    // 静态成员变量
+    static constexpr int MAX_FRAME_SIZE = 256;
+    static constexpr int RESPONSE_TIMEOUT = 1000; // 请求后无响应的判定时间(ms)
+    static constexpr qsizetype COMPACT_THRESHOLD = 4096; // 已消费数据超过该值才搬移
+
+    // 核心数据成员
+    SerialPortManager* m_pSerialPortManager = nullptr;
+    QByteArray m_buffer;
+    PendingRequest m_pending;
+    QTimer* m_pResponseTimer = nullptr;
+
+    // 状态变量
+    bool m_isRunning = false;
+    qsizetype m_readPos = 0;
+    qsizetype m_gapPos = -1; // 最近一次帧间静默后第一个字节的位置，没有时为-1
+    qint64 m_lastArrival = 0; // 上一个数据块的到达时间(ns)，0表示还没有数据
+    quint64 m_frameCount = 0;
+    quint64 m_discardedBytes = 0;
+};
+
+#endif //MODBUSRTUSNIFFER_H
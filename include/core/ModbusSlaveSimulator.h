@@ -0,0 +1,168 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusSlaveSimulator.h
+  * @author         : wangxiangyu
+  * @brief          : 进程内Modbus从站仿真器，通过伪终端(RTU)或本地TCP端口(TCP)应答请求
+  * @attention      : 需移入独立线程运行，所有方法都应在所属线程中调用；
+  *                   点位值可由JavaScript表达式按时间生成，并可注入延迟、异常、CRC错误和丢帧
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MODBUSSLAVESIMULATOR_H
+#define MODBUSSLAVESIMULATOR_H
+
+#include <QObject>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QSocketNotifier>
+#include <QJSEngine>
+#include <QJSValue>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+#include <QHash>
+#include <QList>
+#include <QVector>
+#include <QPair>
+#include <QMetaType>
+#include <QPointer>
+#include <functional>
+#include "utils/ModbusRtuParser.h"
+#include "utils/ModbusCrc.h"
+
+// 故障注入配置，概率取值0~1
+struct ModbusSimulatorFaults
+{
+    int minLatency = 0; // 应答延迟(ms)，在[minLatency, maxLatency]内均匀随机
+    int maxLatency = 0;
+    double exceptionRate = 0.0; // 以0x04从站设备故障应答
+    double crcErrorRate = 0.0; // 破坏应答的CRC，只对RTU生效
+    double dropRate = 0.0; // 不应答
+};
+
+struct ModbusSimulatorStatistics
+{
+    quint64 requestCount = 0;
+    quint64 responseCount = 0;
+    quint64 exceptionCount = 0;
+    quint64 crcErrorCount = 0;
+    quint64 dropCount = 0;
+    double requestRate = 0.0; // 最近一个统计周期的请求数/s
+};
+
+Q_DECLARE_METATYPE(ModbusSimulatorStatistics)
+
+class ModbusSlaveSimulator : public QObject
+{
+    Q_OBJECT
+
+public:
+    // 构造函数和析构函数
+    explicit ModbusSlaveSimulator(QObject* parent = nullptr);
+    ~ModbusSlaveSimulator() override;
+
+    // 创建伪终端，主站串口打开started()给出的从端路径即可通信；仅支持Linux
+    bool startPty();
+    // 在本机所有地址上监听Modbus TCP连接
+    bool startTcp(quint16 port);
+    void stop();
+    bool isRunning() const;
+
+    void setSlaveId(int slaveId);
+    void setFaults(const ModbusSimulatorFaults& faults);
+    // 设置四个数据区的有效地址区间(协议地址，含两端)，访问区间外的地址时应答0x02异常
+    void setValidRanges(const QList<QPair<int, int>>& ranges);
+    // 为点位添加值生成器，address为带数据区前缀的显示地址(如40001)；
+    // expression可使用t(启动后的秒数)和n(更新次数)，返回数组时依次写入连续地址
+    bool addGenerator(int address, const QString& expression, QString* errorMessage = nullptr);
+    void clearGenerators();
+
+signals:
+    void started(const QString& endpoint);
+    void stopped();
+    void errorOccurred(const QString& message);
+    void statisticsUpdated(const ModbusSimulatorStatistics& statistics);
+
+private slots:
+    void onPtyReadyRead();
+    void onNewConnection();
+    void onSocketReadyRead();
+    void onSocketDisconnected();
+    void onUpdateTimeout();
+    void onStatisticsTimeout();
+
+private:
+    // 一个数据区的存储：位区每个地址存0/1
+    enum Area
+    {
+        Coils,
+        DiscreteInputs,
+        InputRegisters,
+        HoldingRegisters,
+        AreaCount
+    };
+
+    struct Generator
+    {
+        Area area;
+        int address; // 协议地址
+        QJSValue function;
+    };
+
+    // 私有方法
+    void startCommon();
+    void handleRtuFrame(const QByteArray& frame);
+    void handleTcpFrame(QTcpSocket* socket, const QByteArray& frame);
+    // 处理请求PDU，返回应答PDU；不应答(广播写)时返回空数组
+    QByteArray processPdu(const QByteArray& pdu);
+    QByteArray readBits(Area area, const QByteArray& pdu);
+    QByteArray readRegisters(Area area, const QByteArray& pdu);
+    QByteArray writeSingleCoil(const QByteArray& pdu);
+    QByteArray writeSingleRegister(const QByteArray& pdu);
+    QByteArray writeMultipleCoils(const QByteArray& pdu);
+    QByteArray writeMultipleRegisters(const QByteArray& pdu);
+    QByteArray readWriteMultipleRegisters(const QByteArray& pdu);
+    bool isValidRange(int start, int quantity) const;
+    // 按故障配置丢弃或改写应答PDU，返回false表示不应答
+    bool applyFaults(QByteArray& pdu);
+    // 经过随机延迟后发出应答
+    void sendDelayed(const std::function<void()>& send);
+    void writeValue(Area area, int address, const QJSValue& value);
+    void writePty(const QByteArray& data);
+    void closePty();
+    static QByteArray exceptionPdu(quint8 functionCode, quint8 exceptionCode);
+    static quint16 readUInt16(const QByteArray& data, int offset);
+    static void appendUInt16(QByteArray& data, quint16 value);
+    static bool addressToArea(int address, Area& area, int& protocolAddress);
+
+    // 静态成员变量
+    static constexpr int AREA_SIZE = 65536;
+    static constexpr int UPDATE_INTERVAL = 100; // 生成器刷新周期(ms)
+    static constexpr int STATISTICS_INTERVAL = 1000;
+
+    // 核心数据成员
+    QVector<quint16> m_areas[AreaCount];
+    QList<QPair<int, int>> m_validRanges;
+    QList<Generator> m_generators;
+    ModbusSimulatorFaults m_faults;
+    ModbusSimulatorStatistics m_statistics;
+    ModbusRtuParser m_rtuParser{ModbusRtuParser::FrameType::Request};
+    QHash<QTcpSocket*, QByteArray> m_tcpBuffers;
+    QJSEngine* m_pJsEngine = nullptr;
+    QTcpServer* m_pTcpServer = nullptr;
+    QSocketNotifier* m_pPtyNotifier = nullptr;
+    QTimer* m_pUpdateTimer = nullptr;
+    QTimer* m_pStatisticsTimer = nullptr;
+    QRandomGenerator m_random{QRandomGenerator::securelySeeded()};
+
+    // 状态变量
+    int m_slaveId = 1;
+    int m_ptyMasterFd = -1;
+    int m_ptySlaveFd = -1; // 保持从端打开，主站未连接时读主端不会一直返回EIO
+    quint64 m_updateCount = 0;
+    quint64 m_lastRequestCount = 0;
+    QElapsedTimer m_clock;
+};
+
+#endif //MODBUSSLAVESIMULATOR_H
@@ -23,6 +23,7 @@
 #include <QSet>
 #include <functional>
 #include <atomic>
+#include <chrono>
 #include "ui/CMessageBox.h"
 #include "utils/ThreadPoolManager.h"
 #include "core/ChannelManager.h"
@@ -65,7 +66,10 @@ public slots:
 signals:
     void statusChanged(const QString& status, int connectStatus = -1);
     void sendData2ReceiveChanged(const QString& data);
-    void sendReadData2Modbus(const QByteArray& data);
+    // timestamp为读到数据时的单调时钟(steady_clock，ns)，总线监听据此判断帧间静默
+    void sendReadData2Modbus(const QByteArray& data, qint64 timestamp);
+    // 串口实际写出的原始字节，供原始数据捕获使用
+    void serialPortDataSent(const QByteArray& data);
 
 private slots:
     void onSerialPortRead();
@@ -115,6 +119,7 @@ private:
     QString m_timedSendData;
 
     QByteArray m_readBuffer; // 【新增】用于缓冲零散数据的成员
+    qint64 m_readBufferTimestamp = 0; // 缓冲区中首字节的到达时间(µs)
     QTimer* m_pReadTimer; // 【新增】用于检测数据流暂停的定时器
     QMutex m_bufferMutex; // 【新增】用于保护缓冲区的互斥锁
 };
@@ -44,6 +44,8 @@ public:
     Mode getCurrentMode() const;
     bool isHexDisplayEnabled();
     bool isTimestampEnabled();
+    // 客户端模式下是否已连接，Modbus TCP只走客户端连接
+    bool isClientConnected() const;
 
 public slots:
     // 以客户端模式启动
@@ -59,6 +61,8 @@ public slots:
     void setHexSendStatus(bool status);
     void startTimedSend(double interval, const QString& data, QTcpSocket* clientSocket);
     void stopTimedSend();
+    void handleWriteDataFromModbus(const QByteArray& data);
+    void setUseModbusStatus(bool status);
 
 signals:
     // 专用于客户端的状态信息变化信号
@@ -69,6 +73,8 @@ signals:
     void clientConnected(const QString& clientInfo, QTcpSocket* clientSocket);
     // 客户端断开连接信号（仅服务端）
     void clientDisconnected(const QString& clientInfo, QTcpSocket* clientSocket);
+    // 客户端收到的原始数据，不经过20ms合并，供Modbus TCP尽快匹配响应
+    void sendReadData2Modbus(const QByteArray& data);
 
 private slots:
     // 服务端：处理新连接
@@ -104,6 +110,7 @@ private:
     bool m_displayTimestamp = false;
     bool m_hexDisplay = false;
     bool m_hexSend = false;
+    bool m_isUseModbus = false;
 
     QTimer* m_pTimedSendTimer;
     QString m_timedSendData;
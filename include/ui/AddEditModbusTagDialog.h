@@ -21,6 +21,8 @@
 #include <QPushButton>
 #include <QDialogButtonBox>
 #include "utils/ModbusTag.h"
+#include "utils/ModbusUtils.h"
+#include "core/ChannelManager.h"
 #include <QFormLayout>
 
 class AddEditModbusTagDialog : public QDialog
@@ -35,6 +37,7 @@ public:
 private slots:
     void onSaveButtonClicked();
     void onDataTypeChanged(int index);
+    void onFunctionCodeChanged(int index);
 
 private:
     void setUI();
@@ -57,6 +60,9 @@ private:
     QComboBox* m_pByteOrderComboBox = nullptr;
     QDoubleSpinBox* m_pGainSpinBox = nullptr;
     QDoubleSpinBox* m_pOffsetSpinBox = nullptr;
+    QSpinBox* m_pScanIntervalSpinBox = nullptr;
+    QComboBox* m_pScanPriorityComboBox = nullptr;
+    QComboBox* m_pChannelComboBox = nullptr;
     QPushButton* m_pSaveButton = nullptr;
     QPushButton* m_pCancelButton = nullptr;
 };
@@ -26,18 +26,26 @@
 #include <QPlainTextEdit>
 #include <QTableView>
 #include <QHeaderView>
+#include <QTabWidget>
+#include <QScrollBar>
+#include <QTimer>
 #include "ui/TagManagerDialog.h"
 #include "ui/ModbusTagModel.h"
+#include "ui/ModbusTransactionLogModel.h"
+#include "ui/ModbusSimulatorDialog.h"
 #include "core/ModbusController.h"
+#include "core/ModbusPollScheduler.h"
+#include "core/ModbusRequestPlanner.h"
+#include "core/ModbusRtuSniffer.h"
 #include "utils/ModbusUtils.h"
-#include <QTimer>
-
-struct ModbusReadRequest
-{
-    int slaveId;
-    int startAddress; // 协议地址 (从0开始)
-    int quantity;
-};
+#include "utils/PacketProcessor.h"
+#include "core/ChannelManager.h"
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMap>
+#include <QPair>
+#include <QSet>
+#include <QRegularExpression>
 
 class ModbusDisplayWidget : public QWidget
 {
@@ -51,10 +59,20 @@ private slots:
     void onReadButtonClicked();
     void onWriteButtonClicked();
     void onPollButtonToggled(bool checked);
-    void onPollTimerTimeout();
+    void onSnifferButtonToggled(bool checked);
+    void onTransportChanged(int index);
+    void onPlanInvalidated();
+    void onSlaveStatusChanged(int slaveId, bool online);
+    void onScanStatisticsUpdated(const QList<ModbusScanGroupStatistics>& statistics);
     void onConfigTagsButtonClicked();
+    void onSimulatorButtonClicked();
     void onClearLogButtonClicked();
-    void onModbusDataReady(int startAddress, const QList<quint16>& values);
+    void onCounterTimeout();
+    void onReadFuncCodeChanged(int index);
+    void onWriteFuncCodeChanged(int index);
+    void onModbusDataReady(int requestId, int functionCode, int startAddress, const QList<quint16>& values);
+    void onScanResponseReady(const ModbusReadRequest& request, const QList<quint16>& values);
+    void onSniffedValuesObserved(int slaveId, int functionCode, int startAddress, const QList<quint16>& values);
     void onWriteSuccessful(int functionCode, int address);
 
 private:
@@ -62,7 +80,17 @@ private:
     void createComponents();
     void createLayout();
     void connectSignals();
-    void generateReadRequests();
+    void generateScanGroups();
+    void stopPolling();
+    // 轮询或监听期间锁定会改变请求或链路的控件
+    void setBusControlsEnabled(bool enabled);
+    // 按解码步骤更新点位，并把绑定了波形通道的点位值送入波形
+    void applyDecodePlan(const QList<ModbusDecodeEntry>& plan, const QList<quint16>& values);
+    bool applyDecodeEntry(const ModbusDecodeEntry& entry, const QList<quint16>& values);
+
+    // 静态成员变量
+    static constexpr int MAX_LOG_LINES = 5000;
+    static constexpr int COUNTER_INTERVAL = 1000;
 
     // --- 整体布局 ---
     QVBoxLayout* m_pMainLayout = nullptr;
@@ -80,6 +108,8 @@ private:
     // --- "操作区" 内的控件 ---
     QLabel* m_pReadLabel = nullptr;
     QSpinBox* m_pReadSlaveIdSpinBox = nullptr;
+    QLabel* m_pReadFuncCodeLabel = nullptr;
+    QComboBox* m_pReadFuncCodeComboBox = nullptr;
     QLabel* m_pReadAddrLabel = nullptr;
     QComboBox* m_pReadAddrComboBox = nullptr;
     QLabel* m_pReadQtyLabel = nullptr;
@@ -102,27 +132,51 @@ private:
 
     // --- "控制与配置区" 内的控件 ---
     QPushButton* m_pPollButton = nullptr;
+    QPushButton* m_pSnifferButton = nullptr;
+    QLabel* m_pTransportLabel = nullptr;
+    QComboBox* m_pTransportComboBox = nullptr;
+    QLabel* m_pMaxInFlightLabel = nullptr;
+    QSpinBox* m_pMaxInFlightSpinBox = nullptr;
+    QLabel* m_pRetryLabel = nullptr;
+    QSpinBox* m_pRetrySpinBox = nullptr;
     QLabel* m_pPollIntervalLabel = nullptr;
     QSpinBox* m_pPollIntervalSpinBox = nullptr;
+    QLabel* m_pScanRateLabel = nullptr;
+    QPushButton* m_pSimulatorButton = nullptr;
     QPushButton* m_pConfigTagsButton = nullptr;
 
     // --- "数据显示区" 内的控件 ---
     QTableView* m_pDisplayTableView = nullptr;
 
     // --- "日志区" 内的控件 ---
+    QTabWidget* m_pLogTabWidget = nullptr;
     QPlainTextEdit* m_pLogTextEdit = nullptr;
+    QLabel* m_pTransactionCounterLabel = nullptr;
+    QTableView* m_pTransactionTableView = nullptr;
     QPushButton* m_pClearLogButton = nullptr;
 
     QList<ModbusTag> m_modbusTags;
     ModbusTagModel* m_pTagModel = nullptr;
+    // 每次请求尝试的结构化记录，保存在有界环形存储中
+    ModbusTransactionLogModel* m_pTransactionLogModel = nullptr;
+    QTimer* m_pCounterTimer = nullptr; // 每秒刷新一次事务计数
+    quint64 m_lastRequestCount = 0;
+    bool m_isTransactionLogAtBottom = true; // 插入新记录前是否停在末尾，是则自动滚动
 
     ModbusController* m_pModbusController = nullptr;
 
-    QTimer* m_pPollTimer = nullptr;
+    ModbusPollScheduler* m_pPollScheduler = nullptr;
+    ModbusRequestPlanner* m_pRequestPlanner = nullptr;
+    ModbusRtuSniffer* m_pSniffer = nullptr;
+    // 监听期间点位表不可编辑：(从站 << 8 | 数据区读功能码) -> 点位下标
+    QHash<int, QList<int>> m_snifferTagIndex;
+    ModbusSimulatorDialog* m_pSimulatorDialog = nullptr; // 首次打开时创建，关闭后仿真继续运行
     bool m_isPolling = false;
-    // 用于存放优化后的读请求列表
-    QList<ModbusReadRequest> m_readRequests;
-    int m_currentRequestIndex = 0; // 当前发送到哪个请求的索引
+    // 按扫描周期和优先级分组、组内合并后的读请求
+    QList<ModbusScanGroup> m_scanGroups;
+    QSet<int> m_manualRequestIds; // 手动读取和0x17回读的请求编号，响应按点位表通用解码
+    // 波形时间轴：录波后首个响应为0，清空波形数据时重新计时
+    QElapsedTimer m_waveformClock;
 };
 
 #endif //MODBUSDISPLAYWIDGET_H
@@ -0,0 +1,78 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusSimulatorDialog.h
+  * @author         : wangxiangyu
+  * @brief          : Modbus从站仿真器的配置与状态对话框
+  * @attention      : 非模态，关闭对话框只是隐藏，仿真器在独立线程中继续运行
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MODBUSSIMULATORDIALOG_H
+#define MODBUSSIMULATORDIALOG_H
+
+#include <QDialog>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QFormLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QSpinBox>
+#include <QDoubleSpinBox>
+#include <QComboBox>
+#include <QPushButton>
+#include <QPlainTextEdit>
+#include <QThread>
+#include <QRegularExpression>
+#include "core/ModbusSlaveSimulator.h"
+#include "ui/CMessageBox.h"
+
+class ModbusSimulatorDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    // 构造函数和析构函数
+    explicit ModbusSimulatorDialog(QWidget* parent = nullptr);
+    ~ModbusSimulatorDialog() override;
+
+private slots:
+    void onStartButtonToggled(bool checked);
+    void onLinkTypeChanged(int index);
+    void onSimulatorStarted(const QString& endpoint);
+    void onSimulatorStopped();
+    void onSimulatorError(const QString& message);
+    void onStatisticsUpdated(const ModbusSimulatorStatistics& statistics);
+    void applyFaults();
+
+private:
+    void setUI();
+    void createComponents();
+    void createLayout();
+    void connectSignals();
+    void setConfigEnabled(bool enabled);
+    // 解析"0-99,200-299"形式的有效地址区间
+    bool parseValidRanges(QList<QPair<int, int>>& ranges) const;
+
+    // --- UI 控件 ---
+    QFormLayout* m_pFormLayout = nullptr;
+    QComboBox* m_pLinkTypeComboBox = nullptr;
+    QSpinBox* m_pTcpPortSpinBox = nullptr;
+    QSpinBox* m_pSlaveIdSpinBox = nullptr;
+    QLineEdit* m_pValidRangesLineEdit = nullptr;
+    QSpinBox* m_pMinLatencySpinBox = nullptr;
+    QSpinBox* m_pMaxLatencySpinBox = nullptr;
+    QDoubleSpinBox* m_pExceptionRateSpinBox = nullptr;
+    QDoubleSpinBox* m_pCrcErrorRateSpinBox = nullptr;
+    QDoubleSpinBox* m_pDropRateSpinBox = nullptr;
+    QPlainTextEdit* m_pGeneratorTextEdit = nullptr;
+    QLabel* m_pEndpointLabel = nullptr;
+    QLabel* m_pStatisticsLabel = nullptr;
+    QPushButton* m_pStartButton = nullptr;
+
+    // 仿真器运行在独立线程，只通过invokeMethod访问
+    QThread* m_pSimulatorThread = nullptr;
+    ModbusSlaveSimulator* m_pSimulator = nullptr;
+};
+
+#endif //MODBUSSIMULATORDIALOG_H
@@ -11,6 +11,8 @@
 
 #include <QAbstractTableModel>
 #include <QList>
+#include <QVector>
+#include <QTimer>
 #include "utils/ModbusTag.h"
 
 class ModbusTagModel : public QAbstractTableModel
@@ -30,11 +32,31 @@ public:
 public slots:
     // 用于通知模型，点位配置列表已发生结构性变化（增/删/改）
     void layoutRefresh();
-    // 用于通知模型，某个点位的实时值已更新
+    // 用于通知模型，某个点位的实时值已更新；只记录脏行，下一帧合并为一次dataChanged
     void valueUpdate(int rowIndex);
 
+private slots:
+    void flushDirtyRows();
+
 private:
+    // 十六进制列的显示文本在视图请求时才格式化，值不变时重复绘制直接复用
+    struct DisplayCache
+    {
+        QString hexText;
+        bool isValid = false;
+    };
+
+    QString hexText(int row) const;
+
+    // 静态成员变量
+    static constexpr int REFRESH_INTERVAL = 16; // 刷新周期(ms)，约一帧
+
     QList<ModbusTag>* m_tags; // 指向外部数据源的指针
+    mutable QVector<DisplayCache> m_displayCache;
+    QTimer* m_pRefreshTimer = nullptr;
+    // 自上次刷新以来值发生变化的行范围，-1表示没有
+    int m_dirtyFirst = -1;
+    int m_dirtyLast = -1;
 };
 
 #endif // MODBUSTAGMODEL_H
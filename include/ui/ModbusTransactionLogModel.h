@@ -0,0 +1,77 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusTransactionLogModel.h
+  * @author         : wangxiangyu
+  * @brief          : Modbus事务记录的 TableView 模型
+  * @attention      : 记录先进入待显示队列，定时在一次行插入/删除通知中写入环形存储；
+  *                   时间、结果和原始帧等文本只在视图请求可见行时才格式化
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MODBUSTRANSACTIONLOGMODEL_H
+#define MODBUSTRANSACTIONLOGMODEL_H
+
+#include <QAbstractTableModel>
+#include <QTimer>
+#include <QDateTime>
+#include <QColor>
+#include "utils/ModbusTransactionLog.h"
+#include "utils/ModbusUtils.h"
+
+class ModbusTransactionLogModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    // 列定义
+    enum Column
+    {
+        TimeColumn,
+        SlaveColumn,
+        FunctionColumn,
+        AddressColumn,
+        QuantityColumn,
+        LatencyColumn,
+        ResultColumn,
+        RequestColumn,
+        ResponseColumn,
+        ColumnCount
+    };
+
+    // 构造函数和析构函数
+    explicit ModbusTransactionLogModel(QObject* parent = nullptr);
+    ~ModbusTransactionLogModel() override = default;
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    const ModbusTransactionLog& getLog() const;
+
+public slots:
+    void append(const ModbusTransactionRecord& record);
+    void clear();
+
+private slots:
+    void flushPendingRows();
+
+private:
+    // 私有方法
+    static QString resultText(const ModbusTransactionRecord& record);
+
+    // 静态成员变量
+    static constexpr int REFRESH_INTERVAL = 100; // 行变化的合并周期(ms)
+
+    // 核心数据成员
+    ModbusTransactionLog m_log; // 只包含已通知视图的记录
+    QVector<ModbusTransactionRecord> m_pendingRecords;
+    QTimer* m_pRefreshTimer = nullptr;
+
+    // 状态变量
+    int m_shownRows = 0; // 已通知视图的行数
+    int m_hiddenRows = 0; // 已从视图移除、尚未被覆盖的最旧记录数
+};
+
+#endif //MODBUSTRANSACTIONLOGMODEL_H
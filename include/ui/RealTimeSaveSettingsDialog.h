@@ -0,0 +1,71 @@
+/**
+  ******************************************************************************
+  * @file           : RealTimeSaveSettingsDialog.h
+  * @author         : wangxiangyu
+  * @brief          : 实时保存分段设置对话框
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef REALTIMESAVESETTINGSDIALOG_H
+#define REALTIMESAVESETTINGSDIALOG_H
+
+#include "ui/CDialogBase.h"
+#include "utils/AsyncFileWriter.h"
+#include <QSpinBox>
+#include <QLineEdit>
+#include <QCheckBox>
+#include <QFormLayout>
+#include <QComboBox>
+
+class RealTimeSaveSettingsDialog : public CDialogBase
+{
+    Q_OBJECT
+
+public:
+    // 保存内容
+    enum class SaveContent
+    {
+        Text, // 与接收区显示一致的格式化文本
+        Raw, // 带时间戳、方向和来源的原始字节(.sdtr)
+        RawAndText // 原始字节为主，同时保存格式化文本
+    };
+    Q_ENUM(SaveContent)
+
+    // 构造函数和析构函数
+    explicit RealTimeSaveSettingsDialog(QWidget* parent = nullptr);
+
+    // 获取方法
+    LogRotationConfig getRotationConfig() const;
+    SaveContent getSaveContent() const;
+    AsyncFileWriter::SyncPolicy getSyncPolicy() const;
+
+    // 配置方法
+    void setRotationConfig(const LogRotationConfig& config);
+    void setSaveContent(SaveContent content);
+    void setSyncPolicy(AsyncFileWriter::SyncPolicy policy);
+
+protected:
+    // 重写基类虚函数
+    void createComponents() override;
+    void createContentLayout() override;
+    void connectSignals() override;
+    void onConfirmClicked() override;
+
+private:
+    // 私有方法
+    void setUI();
+    void updateRotationWidgets();
+
+    // UI组件成员
+    QComboBox* m_pSaveContentComboBox = nullptr;
+    QComboBox* m_pSyncPolicyComboBox = nullptr;
+    QSpinBox* m_pSegmentSizeSpinBox = nullptr;
+    QSpinBox* m_pSegmentDurationSpinBox = nullptr;
+    QLineEdit* m_pNameTemplateLineEdit = nullptr;
+    QCheckBox* m_pCompressCheckBox = nullptr;
+    QSpinBox* m_pMaxTotalSizeSpinBox = nullptr;
+};
+
+#endif //REALTIMESAVESETTINGSDIALOG_H
@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @file           : ReceiveDataSaveDialog.h
+  * @author         : wangxiangyu
+  * @brief          : 保存接收数据的筛选条件对话框
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef RECEIVEDATASAVEDIALOG_H
+#define RECEIVEDATASAVEDIALOG_H
+
+#include "ui/CDialogBase.h"
+#include "utils/ReceiveRecordStore.h"
+#include <QCheckBox>
+#include <QDateTimeEdit>
+#include <QLineEdit>
+#include <QFormLayout>
+
+class ReceiveDataSaveDialog : public CDialogBase
+{
+    Q_OBJECT
+
+public:
+    // 构造函数和析构函数
+    explicit ReceiveDataSaveDialog(QWidget* parent = nullptr);
+
+    // 获取方法
+    ReceiveRecordFilter getFilter() const;
+
+    // 配置方法
+    void setTimeRange(qint64 startTime, qint64 endTime);
+
+protected:
+    // 重写基类虚函数
+    void createComponents() override;
+    void createContentLayout() override;
+    void connectSignals() override;
+    void onConfirmClicked() override;
+
+private:
+    // 私有方法
+    void setUI();
+
+    // UI组件成员
+    QCheckBox* m_pTimeRangeCheckBox = nullptr;
+    QDateTimeEdit* m_pStartTimeEdit = nullptr;
+    QDateTimeEdit* m_pEndTimeEdit = nullptr;
+    QLineEdit* m_pKeywordLineEdit = nullptr;
+    QCheckBox* m_pCaseSensitiveCheckBox = nullptr;
+};
+
+#endif //RECEIVEDATASAVEDIALOG_H
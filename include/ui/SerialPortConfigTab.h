@@ -23,6 +23,12 @@
 #include "utils/StyleLoader.h"
 #include "ui/SerialPortRealTimeSaveWidget.h"
 #include <QFileDialog>
+#include "utils/AsyncFileWriter.h"
+#include "ui/CMessageBox.h"
+#include "ui/RealTimeSaveSettingsDialog.h"
+#include "utils/RawCaptureFormat.h"
+#include "utils/ReceiveRecordStore.h"
+#include <QTimer>
 
 class SerialPortConfigTab : public QWidget
 {
@@ -45,6 +51,13 @@ private:
     void createComponents();
     void createLayout();
     void connectSignals();
+    bool openSaveWriters(const QString& fileName);
+    void recoverRawCaptures(const QFileInfo& fileInfo);
+    void closeSaveWriters();
+    void updateSavePathDisplay();
+
+    // 静态成员变量
+    static constexpr qint64 PROLOGUE_CHUNK_SIZE = 1024 * 1024;
 
     // 布局成员
     QHBoxLayout* m_pMainLayout = nullptr;
@@ -61,8 +74,12 @@ private:
     SerialPortDataSendWidget* m_pSerialPortDataSendWidget = nullptr;
     SerialPortRealTimeSaveWidget* m_pSerialPortRealTimeSaveWidget = nullptr;
 
-    // 文件对象
-    QFile* m_pSaveFile = nullptr;
+    // 实时保存写线程
+    AsyncFileWriter* m_pSaveWriter = nullptr;
+    AsyncFileWriter* m_pRawCaptureWriter = nullptr;
+    RealTimeSaveSettingsDialog::SaveContent m_saveContent = RealTimeSaveSettingsDialog::SaveContent::Text;
+    QString m_textSavePath;
+    QString m_rawSavePath;
 };
 
 #endif //SERIALPORTCONFIG_H
@@ -23,6 +23,11 @@
 #include "ui/SerialPortConnectConfigWidget.h"
 #include <QFileDialog>
 #include <QTextBlock>
+#include <QProgressDialog>
+#include <QTimer>
+#include "utils/ReceiveRecordStore.h"
+#include "utils/ReceiveDataExporter.h"
+#include "ui/ReceiveDataSaveDialog.h"
 
 
 class SerialPortDataReceiveWidget : public QWidget
@@ -49,6 +54,7 @@ protected:
 private slots:
     void onDisplayReceiveData(const QString& data);
     void onDisplaySentDataWithHighlight(const QString& data);
+    void onSaveFinished(bool success, const QString& message);
 
 private:
     // 私有方法
@@ -56,12 +62,20 @@ private:
     void createComponents();
     void createLayout();
     void connectSignals();
+    void appendLine(const QString& data, bool isSent);
+
+    // 静态成员变量
+    static constexpr int MAX_DISPLAY_LINES = 10000;
 
     // 布局成员
     QVBoxLayout* m_pMainLayout = nullptr;
 
     // UI组件成员
     QPlainTextEdit* m_pReceiveTextEdit = nullptr;
+    QProgressDialog* m_pProgressDialog = nullptr;
+
+    // 保存任务
+    ReceiveDataExporter* m_pExporter = nullptr;
 };
 
 #endif //SERIALPORTDATARECEIVEWIDGET_H
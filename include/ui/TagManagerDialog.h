@@ -20,6 +20,11 @@
 #include "utils/ModbusTag.h"
 #include "ui/AddEditModbusTagDialog.h"
 #include "ui/CMessageBox.h"
+#include "utils/ModbusTagFile.h"
+#include "utils/ThreadPoolManager.h"
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QDir>
 #include <QHBoxLayout>
 
 class TagManagerDialog : public QDialog
@@ -37,6 +42,10 @@ private slots:
     void onAddButtonClicked();
     void onEditButtonClicked();
     void onDeleteButtonClicked();
+    void onImportButtonClicked();
+    void onExportButtonClicked();
+    void onTagsLoaded(bool success, const QString& message, const QList<ModbusTag>& tags);
+    void onTagsSaved(bool success, const QString& message);
 
 private:
     void setUI();
@@ -45,6 +54,8 @@ private:
     void connectSignals();
     void populateList();
     QString dataTypeToString(ModbusTag::DataType type);
+    void setFileButtonsEnabled(bool enabled);
+    void releaseTagFile();
 
     QVBoxLayout* m_pMainLayout = nullptr;
 
@@ -53,7 +64,10 @@ private:
     QPushButton* m_pAddButton = nullptr;
     QPushButton* m_pEditButton = nullptr;
     QPushButton* m_pDeleteButton = nullptr;
+    QPushButton* m_pImportButton = nullptr;
+    QPushButton* m_pExportButton = nullptr;
     QPushButton* m_pSaveButton = nullptr;
+    ModbusTagFile* m_pTagFile = nullptr; // 正在后台导入或导出的文件，同一时间只有一个
 };
 
 #endif //TAGMANAGERDIALOG_H
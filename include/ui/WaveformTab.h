@@ -14,8 +14,6 @@
 
 #include <QWidget>
 #include "utils/StyleLoader.h"
-#include <QWebEngineView>
-#include <QWebEngineSettings>
 #include <QVBoxLayout>
 #include <QDebug>
 #include <QJsonDocument>
@@ -2,7 +2,7 @@
   ******************************************************************************
   * @file           : WaveformWidget.h
   * @author         : wangxiangyu
-  * @brief          : None
+  * @brief          : 基于QPainter的原生波形显示控件
   * @attention      : None
   * @date           : 2025/7/31
   ******************************************************************************
@@ -13,19 +13,25 @@
 
 #include <QWidget>
 #include "utils/StyleLoader.h"
-#include <QWebEngineView>
-#include <QWebEngineSettings>
-#include <QVBoxLayout>
+#include "utils/WaveformSampleStore.h"
+#include "utils/WaveformExporter.h"
+#include "utils/WaveformImporter.h"
+#include "utils/ThreadPoolManager.h"
+#include "ui/CMessageBox.h"
+#include <QPainter>
+#include <QPaintEvent>
+#include <QMouseEvent>
+#include <QWheelEvent>
 #include <QDebug>
 #include <QJsonDocument>
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QTimer>
-#include <QUrl>
 #include <cmath>
 #include "core/ChannelManager.h"
-#include <memory>
 #include <QFileDialog>
+#include <QFileInfo>
+#include <QProgressDialog>
 #include <utils/PacketProcessor.h>
 
 class WaveformWidget : public QWidget
@@ -39,63 +45,107 @@ public:
 
 protected:
     // 事件处理方法
-    void resizeEvent(QResizeEvent* event) override;
+    void paintEvent(QPaintEvent* event) override;
+    void wheelEvent(QWheelEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+    void mouseReleaseEvent(QMouseEvent* event) override;
+    void mouseDoubleClickEvent(QMouseEvent* event) override;
+    void leaveEvent(QEvent* event) override;
 
 private slots:
-    void onPageLoadFinished(bool success);
     void onChannelAdded(const QString& name, const QString& color);
     void onChannelRemoved(const QString& name);
-    void onWaveformDataAdded(const QString& channelId, const QVariant& data);
-    void onProcessPendingData();
+    void onWaveformBlockReady(const QString& channelName, const QVector<double>& timestamps,
+                              const QVector<double>& values);
+    void onRenderTimerTimeout();
     void onChannelsDataAllCleared();
     void onChannelsDataImported();
+    void onImportChannelFound(const QString& name);
+    void onImportDataRangeChanged(double maxTime, double maxAbs);
+    void onImportFinished(bool success, const QString& message);
     void onChannelsDataExported();
+    void onExportFinished(bool success, const QString& message);
 
 private:
     // 私有方法
     void setUI();
     void createComponents();
-    void createLayout();
     void connectSignals();
-    void webEngineViewSettings();
-    void executeJS(const QString& jsCode);
-    void checkAndUpdateData();
-    void flushPendingJSCommands();
+    void addSeries(const QString& name, const QColor& color, bool imported);
+    void createProgressDialog(const QString& labelText);
+    void closeProgressDialog();
+    void resetView();
+    void updateAutoRange();
+    void updateYAxisForView();
+    void setViewRange(double xMin, double xMax);
+    QRect calculatePlotRect() const;
+    double xToPixel(double time) const;
+    double yToPixel(double value) const;
+    double pixelToX(double pixel) const;
+
+    // 绘制方法
+    void drawTitleAndLegend(QPainter& painter);
+    void drawAxes(QPainter& painter);
+    void drawSeries(QPainter& painter);
+    void drawHoverInfo(QPainter& painter);
+
+    // 刻度计算
+    static double calculateXAxisInterval(double maxValue);
+    static double calculateYAxisInterval(double maxAbsValue);
+    static double calculateNiceInterval(double range, int targetTickCount);
 
     // 静态成员变量
-    static constexpr int MAX_QUEUE_SIZE = 10000;
+    static constexpr double INITIAL_X_MIN = 0.0;
+    static constexpr double INITIAL_X_MAX = 10000.0; // 初始X轴范围：0-10秒
+    static constexpr double INITIAL_Y_MIN = -100000.0;
+    static constexpr double INITIAL_Y_MAX = 100000.0; // 初始Y轴范围：-100000到100000
+    static constexpr double INITIAL_Y_INTERVAL = 20000.0;
+    static constexpr int RENDER_INTERVAL = 16; // 约60FPS
+    static constexpr int LTTB_MAX_RATIO = 16; // 可见点数超过像素列数的该倍数时改用min/max包络
+    static constexpr int TITLE_HEIGHT = 28;
+    static constexpr int LEGEND_HEIGHT = 22;
 
     // 数据结构定义
-    struct DataPoint
+    struct Series
     {
-        QString channelName;
-        double timestamp;
-        double value;
+        QString name;
+        QColor color;
+        bool imported = false; // 导入的通道在清除数据时整体移除
+        bool visible = true;
     };
 
-    // 布局成员
-    QVBoxLayout* m_pMainLayout = nullptr;
-
     // 核心对象成员
-    std::unique_ptr<QWebEngineView> m_pWebEngineView;
+    WaveformSampleStore* m_pStore = nullptr;
+    QVector<Series> m_series;
+    QVector<QPair<QRect, int>> m_legendHitRects;
 
     // 定时器对象
-    QTimer* m_updateTimer = nullptr;
-    QTimer* m_renderTimer = nullptr;
-    QTimer* m_updateCheckTimer = nullptr;
-
-    // 同步对象
-    mutable QMutex m_dataMutex; // 保护 m_pendingData 的互斥锁
+    QTimer* m_pRenderTimer = nullptr;
+
+    // 导入导出任务
+    WaveformExporter* m_pExporter = nullptr;
+    WaveformImporter* m_pImporter = nullptr;
+    QProgressDialog* m_pProgressDialog = nullptr;
+
+    // 坐标轴状态
+    double m_fullXMin = INITIAL_X_MIN; // 自动跟随模式下的X轴范围
+    double m_fullXMax = INITIAL_X_MAX;
+    double m_viewXMin = INITIAL_X_MIN; // 当前显示的X轴范围
+    double m_viewXMax = INITIAL_X_MAX;
+    double m_yMin = INITIAL_Y_MIN;
+    double m_yMax = INITIAL_Y_MAX;
+    double m_yInterval = INITIAL_Y_INTERVAL;
+    double m_dataMaxAbs = 0.0; // 已接收数据的最大绝对值
+    double m_dataMaxTime = 0.0; // 已接收数据的最大时间戳
 
     // 状态变量
-    bool m_pageLoaded = false;
-    bool m_resizePending = false;
-    bool m_updateScheduled = false;
-    bool m_isResizing = false;
-
-    // 数据队列
-    QQueue<DataPoint> m_pendingData;
-    QStringList m_pendingJSCommands; // 缓存被跳过的JS命令
+    bool m_userInteracted = false;
+    bool m_dirty = true;
+    bool m_isPanning = false;
+    bool m_isHovering = false;
+    QPoint m_lastMousePos;
+    QPoint m_hoverPos;
 };
 
 #endif //WAVEFORMWIDGET_H
@@ -0,0 +1,167 @@
+/**
+  ******************************************************************************
+  * @file           : AsyncFileWriter.h
+  * @author         : wangxiangyu
+  * @brief          : 异步批量文件写入线程，按大小/时间阈值合并提交，支持分段轮转与压缩
+  * @attention      : write() 可在任意线程调用；队列满时阻塞调用方而不是丢弃数据
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef ASYNCFILEWRITER_H
+#define ASYNCFILEWRITER_H
+
+#include <QThread>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QDateTime>
+#include <QQueue>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+#include <QDebug>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include "utils/ThreadPoolManager.h"
+#include "utils/LogSegmentCompressor.h"
+#include "utils/MappedCaptureWriter.h"
+
+// 分段轮转配置，maxSegmentBytes与maxSegmentSeconds都为0时不分段
+struct LogRotationConfig
+{
+    qint64 maxSegmentBytes = 0;
+    int maxSegmentSeconds = 0;
+    // 可用占位符：{name} 原文件名(不含后缀) {suffix} 后缀 {index} 分段序号 {date} 日期 {time} 时间
+    QString nameTemplate = "{name}_{date}_{time}_{index}.{suffix}";
+    bool compressClosedSegments = false;
+    qint64 maxTotalBytes = 0; // 本次保存所有分段的磁盘占用上限，0为不限制
+
+    bool isEnabled() const { return maxSegmentBytes > 0 || maxSegmentSeconds > 0; }
+};
+
+class AsyncFileWriter : public QThread
+{
+    Q_OBJECT
+
+public:
+    // 落盘策略
+    enum class SyncPolicy
+    {
+        None, // 只写入操作系统缓存
+        OnCommit, // 每次批量提交后落盘
+        Periodic // 距上次落盘超过SYNC_INTERVAL后落盘
+    };
+    Q_ENUM(SyncPolicy)
+
+    // 存储方式
+    enum class StorageMode
+    {
+        Stream, // 写线程批量调用write()
+        Mapped // 调用方直接拷贝到预分配的映射文件，不启动写线程，崩溃后可恢复
+    };
+
+    // 构造函数和析构函数
+    explicit AsyncFileWriter(QObject* parent = nullptr);
+    ~AsyncFileWriter() override;
+
+    // 打开文件并启动写线程；已打开时先关闭
+    bool open(const QString& fileName, QIODevice::OpenMode mode = QIODevice::WriteOnly | QIODevice::Text);
+    // 写出队列中剩余数据后关闭文件并结束线程
+    void close();
+    bool write(const QByteArray& data);
+
+    bool isOpen() const;
+    QString getFileName() const;
+    qint64 getBytesWritten() const;
+    void setSyncPolicy(SyncPolicy policy);
+    SyncPolicy getSyncPolicy() const;
+    // 需在open()之前设置
+    void setStorageMode(StorageMode mode);
+    // 需在open()之前设置
+    void setRotationConfig(const LogRotationConfig& config);
+    LogRotationConfig getRotationConfig() const;
+    // 每个分段开头写入的文件头，二进制格式分段后仍可单独解析；需在open()之前设置
+    void setSegmentHeader(const QByteArray& header);
+    // 打开后写线程先反复调用source写出已有数据，直到返回空数组，再写入队列中的数据；
+    // 只对Stream方式生效，需在open()之前设置，写完后自动清除
+    void setPrologueSource(std::function<QByteArray()> source);
+
+signals:
+    void errorOccurred(const QString& message);
+    void segmentOpened(const QString& path);
+    void segmentClosed(const QString& path);
+
+protected:
+    void run() override;
+
+private:
+    // 本次保存产生的所有分段，与后台压缩任务共享
+    struct SegmentRecord
+    {
+        QString path;
+        qint64 size = 0;
+        bool busy = false; // 正在写入或压缩，不能删除
+    };
+
+    struct SegmentRegistry
+    {
+        QMutex mutex;
+        QList<SegmentRecord> segments;
+        qint64 maxTotalBytes = 0;
+
+        void updateSegment(const QString& path, const QString& newPath, qint64 size, bool busy);
+        // 超出磁盘占用上限时删除最早的分段，调用方需持有mutex
+        void enforceLimit();
+    };
+
+    // 私有方法
+    bool commit(QQueue<QByteArray>& batch, qint64 batchBytes);
+    bool writeMapped(const QByteArray& data);
+    bool writePrologue();
+    void updateSegmentSize();
+    bool openSegment();
+    void closeSegment();
+    bool shouldRotate(qint64 batchBytes) const;
+    QString buildSegmentName() const;
+    static bool syncToDisk(QFile& file);
+
+    // 静态成员变量
+    static constexpr qint64 COMMIT_SIZE = 256 * 1024; // 累计到该字节数立即提交
+    static constexpr int COMMIT_INTERVAL = 100; // 首条数据入队后最长等待时间(ms)
+    static constexpr qint64 MAX_QUEUE_BYTES = 16 * 1024 * 1024; // 队列上限，超过时阻塞写入方
+    static constexpr int SYNC_INTERVAL = 1000; // Periodic策略的落盘间隔(ms)
+
+    // 核心数据成员
+    QFile m_file;
+    MappedCaptureWriter m_mappedFile;
+    QQueue<QByteArray> m_queue;
+    QByteArray m_writeBuffer;
+    QString m_baseFileName;
+    QIODevice::OpenMode m_openMode = QIODevice::WriteOnly;
+    StorageMode m_storageMode = StorageMode::Stream;
+    LogRotationConfig m_rotationConfig;
+    QByteArray m_segmentHeader;
+    std::function<QByteArray()> m_prologueSource;
+    std::shared_ptr<SegmentRegistry> m_pSegments;
+
+    // 同步对象
+    mutable QMutex m_mutex;
+    QWaitCondition m_dataAvailable;
+    QWaitCondition m_spaceAvailable;
+    QElapsedTimer m_batchTimer;
+    QElapsedTimer m_syncTimer;
+    QElapsedTimer m_segmentTimer;
+
+    // 状态变量
+    qint64 m_pendingBytes = 0;
+    qint64 m_segmentBytes = 0;
+    int m_segmentIndex = 0;
+    std::atomic<qint64> m_bytesWritten{0};
+    std::atomic<bool> m_isOpen{false};
+    std::atomic<SyncPolicy> m_syncPolicy{SyncPolicy::None};
+    bool m_quit = false;
+};
+
+#endif //ASYNCFILEWRITER_H
@@ -19,6 +19,7 @@ struct DataPacket
 {
   QString sourceInfo; // 数据来源 (e.g., "COM3", "192.168.1.10:12345")
   QByteArray data;    // 原始字节数据
+  qint64 timestamp = 0; // 首字节到达时间(微秒级Unix时间戳)
 };
 
 #endif // DATAPACKET_H
@@ -0,0 +1,30 @@
+/**
+  ******************************************************************************
+  * @file           : LogSegmentCompressor.h
+  * @author         : wangxiangyu
+  * @brief          : 日志分段压缩：按块压缩为多成员gzip文件
+  * @attention      : 每个块是独立的gzip成员，gzip/zcat可直接解压，文件损坏时其余块仍可读
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef LOGSEGMENTCOMPRESSOR_H
+#define LOGSEGMENTCOMPRESSOR_H
+
+#include <QString>
+#include <QByteArray>
+#include <QFile>
+#include <QtGlobal>
+
+namespace LogSegmentCompressor
+{
+    constexpr qint64 BLOCK_SIZE = 1024 * 1024;
+
+    quint32 crc32(const char* data, qsizetype size, quint32 crc = 0);
+    // 将一个数据块编码为完整的gzip成员
+    QByteArray compressBlock(const QByteArray& block, int level = 6);
+    // 压缩source到target，成功后删除source；失败时保留source并返回错误信息
+    bool compressFile(const QString& source, const QString& target, QString& errorString);
+}
+
+#endif //LOGSEGMENTCOMPRESSOR_H
@@ -0,0 +1,99 @@
+/**
+  ******************************************************************************
+  * @file           : MappedCaptureWriter.h
+  * @author         : wangxiangyu
+  * @brief          : 预分配+内存映射的捕获文件写入，文件头中的已提交长度原子更新，崩溃后可恢复
+  * @attention      : 非线程安全，由调用方串行化；文件格式：64字节文件头 + 数据，
+  *                   文件头中committedLength之后的内容视为无效
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MAPPEDCAPTUREWRITER_H
+#define MAPPEDCAPTUREWRITER_H
+
+#include <QFile>
+#include <QString>
+#include <QByteArray>
+#include <QtGlobal>
+
+class MappedCaptureWriter
+{
+public:
+    // 构造函数和析构函数
+    MappedCaptureWriter() = default;
+    ~MappedCaptureWriter();
+    MappedCaptureWriter(const MappedCaptureWriter&) = delete;
+    MappedCaptureWriter& operator=(const MappedCaptureWriter&) = delete;
+
+    // 打开文件；文件已存在时先恢复，append为false则清空后重新写入
+    bool open(const QString& fileName, bool append = false);
+    // 截断预分配的空白区域并标记为正常关闭；截断失败时文件保持脏标记，下次打开时恢复
+    bool close();
+    bool append(const char* data, qsizetype size);
+    bool append(const QByteArray& data);
+    // 将映射页写回磁盘，防止断电丢失；进程崩溃时不需要
+    bool flush();
+
+    bool isOpen() const;
+    qint64 size() const;
+    QString fileName() const;
+    QString errorString() const;
+
+    // 检查文件是否为映射捕获文件，是则返回数据区长度，否则返回-1
+    static qint64 readCommittedLength(QIODevice& device);
+    static bool isMappedCapture(const QString& fileName);
+    // 非正常关闭的文件截断到已提交长度并标记为正常关闭
+    static bool recover(const QString& fileName, QString& errorString);
+
+    // 静态成员变量
+    static constexpr char FILE_MAGIC[4] = {'S', 'D', 'T', 'M'};
+    static constexpr quint16 FILE_VERSION = 1;
+    static constexpr qint64 HEADER_SIZE = 64;
+    static constexpr qint64 PREALLOCATE_SIZE = 64 * 1024 * 1024; // 每次扩展的文件大小
+    static constexpr qint64 WINDOW_SIZE = 16 * 1024 * 1024; // 数据映射窗口大小
+
+private:
+    // 文件头，小端存储，committedLength按8字节对齐以便原子更新
+    struct FileHeader
+    {
+        char magic[4];
+        quint16 version;
+        quint16 headerSize;
+        quint32 flags;
+        quint32 reserved;
+        quint64 committedLength;
+        char padding[HEADER_SIZE - 24];
+    };
+    static_assert(sizeof(FileHeader) == HEADER_SIZE);
+
+    enum HeaderFlag : quint32
+    {
+        DirtyFlag = 0x1 // 文件正在写入，未正常关闭
+    };
+
+    // 私有方法
+    bool ensureCapacity(qint64 dataEnd);
+    bool mapHeader();
+    void unmapHeader();
+    bool mapWindow(qint64 dataOffset);
+    void unmapWindow();
+    void storeCommittedLength(qint64 length);
+    static bool preallocate(QFile& file, qint64 size);
+    static bool syncRange(uchar* address, qint64 size);
+
+    // 核心数据成员
+    QFile m_file;
+    FileHeader* m_pHeader = nullptr;
+    uchar* m_pWindow = nullptr;
+    QString m_errorString;
+
+    // 状态变量
+    qint64 m_windowOffset = 0; // 窗口在数据区中的偏移
+    qint64 m_windowSize = 0;
+    qint64 m_committedLength = 0;
+    qint64 m_allocatedSize = 0; // 文件实际大小(含文件头)
+    qint64 m_flushedLength = 0;
+};
+
+#endif //MAPPEDCAPTUREWRITER_H
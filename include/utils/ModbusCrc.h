@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusCrc.h
+  * @author         : wangxiangyu
+  * @brief          : 查表法CRC-16/MODBUS，编译期生成查找表，支持增量计算
+  * @attention      : 帧数据连同其低位在前的CRC一起计算，结果为0即校验通过，无需截取副本
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MODBUSCRC_H
+#define MODBUSCRC_H
+
+#include <QByteArray>
+#include <QtGlobal>
+#include <array>
+#include <span>
+#include <string_view>
+
+namespace ModbusCrc
+{
+    constexpr quint16 INITIAL_VALUE = 0xFFFF;
+    constexpr quint16 POLYNOMIAL = 0xA001; // 0x8005按位反转
+
+    namespace detail
+    {
+        constexpr std::array<quint16, 256> makeTable()
+        {
+            std::array<quint16, 256> table{};
+            for (int i = 0; i < 256; ++i)
+            {
+                quint16 crc = static_cast<quint16>(i);
+                for (int bit = 0; bit < 8; ++bit) crc = (crc & 0x0001) ? (crc >> 1) ^ POLYNOMIAL : crc >> 1;
+                table[i] = crc;
+            }
+            return table;
+        }
+
+        inline constexpr std::array<quint16, 256> TABLE = makeTable();
+    }
+
+    // 在已有CRC基础上追加一个字节
+    constexpr quint16 update(quint16 crc, quint8 byte)
+    {
+        return static_cast<quint16>((crc >> 8) ^ detail::TABLE[(crc ^ byte) & 0xFF]);
+    }
+
+    // 在已有CRC基础上追加一段数据，用于边接收边计算
+    constexpr quint16 update(quint16 crc, std::span<const quint8> data)
+    {
+        for (quint8 byte : data) crc = update(crc, byte);
+        return crc;
+    }
+
+    constexpr quint16 calculate(std::span<const quint8> data)
+    {
+        return update(INITIAL_VALUE, data);
+    }
+
+    inline quint16 update(quint16 crc, const char* data, qsizetype size)
+    {
+        return update(crc, std::span<const quint8>(reinterpret_cast<const quint8*>(data), static_cast<size_t>(size)));
+    }
+
+    inline quint16 calculate(const QByteArray& data)
+    {
+        return update(INITIAL_VALUE, data.constData(), data.size());
+    }
+
+    // 以低位在前的顺序追加CRC，得到完整的RTU帧
+    inline void append(QByteArray& frame)
+    {
+        const quint16 crc = calculate(frame);
+        frame.append(static_cast<char>(crc & 0xFF));
+        frame.append(static_cast<char>((crc >> 8) & 0xFF));
+    }
+
+    // 整帧(含末尾CRC)校验，通过时余数为0
+    inline bool verify(const char* frame, qsizetype size)
+    {
+        return size >= 2 && update(INITIAL_VALUE, frame, size) == 0;
+    }
+
+    namespace detail
+    {
+        constexpr quint16 checkValue()
+        {
+            constexpr std::string_view text = "123456789";
+            quint16 crc = INITIAL_VALUE;
+            for (char ch : text) crc = update(crc, static_cast<quint8>(ch));
+            return crc;
+        }
+
+        static_assert(checkValue() == 0x4B37, "CRC-16/MODBUS查找表生成错误");
+    }
+}
+
+#endif //MODBUSCRC_H
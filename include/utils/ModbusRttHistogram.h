@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusRttHistogram.h
+  * @author         : wangxiangyu
+  * @brief          : 对数分桶的响应延迟直方图，用于估计从站响应时间的分位数
+  * @attention      : 桶宽按比例增长，各量级的相对误差相同；样本数达到上限后整体减半，
+  *                   旧样本的权重逐渐衰减，从站特性变化后分位数能够跟上
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MODBUSRTTHISTOGRAM_H
+#define MODBUSRTTHISTOGRAM_H
+
+#include <QtGlobal>
+#include <array>
+
+class ModbusRttHistogram
+{
+public:
+    // 构造函数和析构函数
+    ModbusRttHistogram() = default;
+    ~ModbusRttHistogram() = default;
+
+    void addSample(double milliseconds);
+    void clear();
+    // 有效样本数(衰减后)
+    quint32 getSampleCount() const;
+    // 返回分位数所在桶的上界(ms)，fraction取0~1；没有样本时返回0
+    double percentile(double fraction) const;
+
+private:
+    // 私有方法
+    static int bucketIndex(double milliseconds);
+    static double bucketUpperBound(int index);
+
+    // 静态成员变量
+    static constexpr int BUCKET_COUNT = 64;
+    static constexpr double MIN_VALUE = 0.05; // 第一个桶的上界(ms)
+    static constexpr double GROWTH_FACTOR = 1.25; // 相邻桶上界之比，64个桶覆盖到约80s
+    static constexpr quint32 MAX_SAMPLES = 1024; // 达到后所有桶减半
+
+    // 核心数据成员
+    std::array<quint32, BUCKET_COUNT> m_buckets{};
+    quint32 m_sampleCount = 0;
+};
+
+#endif //MODBUSRTTHISTOGRAM_H
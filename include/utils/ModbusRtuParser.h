@@ -0,0 +1,73 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusRtuParser.h
+  * @author         : wangxiangyu
+  * @brief          : Modbus RTU帧解析器，读游标扫描接收缓冲区，按长度和增量CRC识别完整帧
+  * @attention      : 失配时只移动游标不搬移数据，已消费的数据累积到阈值后才一次性压缩，
+  *                   噪声较多的线路上解析开销仍与数据量成线性关系
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MODBUSRTUPARSER_H
+#define MODBUSRTUPARSER_H
+
+#include <QByteArray>
+#include <QtGlobal>
+#include "utils/ModbusCrc.h"
+
+class ModbusRtuParser
+{
+public:
+    // 解析的报文方向，决定按请求还是响应的格式计算帧长
+    enum class FrameType
+    {
+        Response, // 从站发出的响应
+        Request // 主站发出的请求
+    };
+
+    // 构造函数和析构函数
+    explicit ModbusRtuParser(FrameType type = FrameType::Response);
+    ~ModbusRtuParser() = default;
+
+    void append(const QByteArray& data);
+    // 取出下一个通过校验的完整帧(从站地址+PDU，不含CRC)；数据不足时返回false
+    bool nextFrame(QByteArray& frame);
+    void clear();
+
+    FrameType getFrameType() const;
+    qsizetype getPendingBytes() const;
+    // 为重新同步而跳过的字节数和CRC校验失败的候选帧数，从构造或clear()起累计
+    qint64 getDiscardedBytes() const;
+    qint64 getCrcErrorCount() const;
+
+    // 根据已到达的字节计算帧长：>0为完整帧长度(含CRC)，0为还需更多数据，-1为不可能是合法帧
+    static int responseLength(const char* data, qsizetype available);
+    static int requestLength(const char* data, qsizetype available);
+
+private:
+    // 私有方法
+    int frameLength(const char* data, qsizetype available) const;
+    bool resyncAhead();
+    void skipByte();
+    void advanceCrc(qsizetype end);
+    void compact();
+
+    // 静态成员变量
+    static constexpr int MIN_FRAME_SIZE = 4; // 从站地址+功能码+CRC
+    static constexpr int MAX_FRAME_SIZE = 256;
+    static constexpr qsizetype COMPACT_THRESHOLD = 4096; // 已消费数据超过该值才搬移
+
+    // 核心数据成员
+    FrameType m_frameType;
+    QByteArray m_buffer;
+    qsizetype m_readPos = 0; // 当前候选帧的起点
+
+    // 状态变量
+    qsizetype m_crcEnd = 0; // 已计入m_crcValue的数据终点(绝对位置)
+    quint16 m_crcValue = ModbusCrc::INITIAL_VALUE;
+    qint64 m_discardedBytes = 0;
+    qint64 m_crcErrorCount = 0;
+};
+
+#endif //MODBUSRTUPARSER_H
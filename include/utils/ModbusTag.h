@@ -47,6 +47,13 @@ struct ModbusTag {
     double gain = 1.0;                // 增益/乘法系数
     double offset = 0.0;              // 偏移/加法量
 
+    // 扫描参数，扫描周期和优先级相同的点位合并为一个扫描组
+    int scanInterval = 0;             // 扫描周期(ms)，0表示跟随轮询间隔
+    int scanPriority = 1;             // 扫描优先级，0低 1中 2高
+
+    // 波形绑定，轮询到的工程值按响应时间送入该通道
+    QString channelId;                // 波形通道标识，为空表示不绑定
+
     // 运行数据
     QVariant currentValue; // 用于存储从设备读取并换算后的实时值
     QVariant rawValue;     // 用于存储从设备读取的原始值 (可选，便于调试)
@@ -0,0 +1,81 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusTagFile.h
+  * @author         : wangxiangyu
+  * @brief          : Modbus点位表的CSV/JSON导入导出，在线程池中执行
+  * @attention      : 导入时逐行校验，任何一行出错则整个文件不导入，错误信息附带行号(JSON为序号)；
+  *                   CSV按表头识别列，列顺序可以调整，缺少的可选列取默认值
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MODBUSTAGFILE_H
+#define MODBUSTAGFILE_H
+
+#include <QObject>
+#include <QFile>
+#include <QHash>
+#include <QList>
+#include <QStringList>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include "utils/ModbusTag.h"
+#include "utils/ModbusUtils.h"
+
+class ModbusTagFile : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class Format
+    {
+        Csv,
+        Json
+    };
+
+    // 构造函数和析构函数
+    explicit ModbusTagFile(const QString& fileName, Format format, QObject* parent = nullptr);
+    ~ModbusTagFile() = default;
+
+    // 在工作线程中调用，完成后分别发出loaded()或saved()
+    void load();
+    void save(const QList<ModbusTag>& tags);
+
+    static Format formatFromFileName(const QString& fileName);
+    // 导出的列，也是导入时识别的字段名
+    static const QStringList& getColumns();
+
+signals:
+    void loaded(bool success, const QString& message, const QList<ModbusTag>& tags);
+    void saved(bool success, const QString& message);
+
+private:
+    // 私有方法
+    bool readCsv(const QByteArray& data, QList<ModbusTag>& tags);
+    bool readJson(const QByteArray& data, QList<ModbusTag>& tags);
+    QByteArray writeCsv(const QList<ModbusTag>& tags) const;
+    QByteArray writeJson(const QList<ModbusTag>& tags) const;
+    // 按字段名取值构造点位并校验，出错时把原因追加到m_errors
+    bool parseTag(const QHash<QString, QString>& fields, const QString& location, ModbusTag& tag);
+    void addError(const QString& location, const QString& reason);
+    static QStringList splitCsvLine(const QString& line, bool* ok);
+    static QString quoteCsvField(const QString& field);
+    static QString dataTypeName(ModbusTag::DataType dataType);
+    static QString byteOrderName(ModbusTag::ByteOrder byteOrder);
+    static QHash<QString, QString> tagFields(const ModbusTag& tag);
+
+    // 静态成员变量
+    static const QStringList COLUMNS;
+    static constexpr int MAX_REPORTED_ERRORS = 10;
+
+    // 核心数据成员
+    QString m_fileName;
+    Format m_format;
+    QStringList m_errors;
+
+    // 状态变量
+    int m_errorCount = 0;
+};
+
+#endif //MODBUSTAGFILE_H
@@ -0,0 +1,97 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusTransactionLog.h
+  * @author         : wangxiangyu
+  * @brief          : Modbus事务记录的环形存储和按从站汇总的计数
+  * @attention      : 容量固定，写满后覆盖最旧的记录；计数不随记录被覆盖而减少，clear()时才清零
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef MODBUSTRANSACTIONLOG_H
+#define MODBUSTRANSACTIONLOG_H
+
+#include <QByteArray>
+#include <QVector>
+#include <QMap>
+#include <QMetaType>
+#include <QtGlobal>
+
+// 一次请求尝试的结果，超时重发的每次尝试各有一条记录
+struct ModbusTransactionRecord
+{
+    enum class Result
+    {
+        Success,
+        Exception, // 从站返回异常应答
+        InvalidResponse, // 功能码、地址或长度与请求不符
+        Timeout,
+        CrcError // RTU响应CRC校验失败，请求随后按超时处理
+    };
+
+    qint64 timestamp = 0; // 结束时间，自1970年起的毫秒数
+    int slaveId = -1;
+    int functionCode = 0;
+    int address = 0; // 协议地址
+    int quantity = 0;
+    double latency = 0.0; // 从发出到结束的耗时(ms)
+    Result result = Result::Success;
+    int exceptionCode = 0;
+    int attempt = 0; // 第几次重发，0为首次发送
+    QByteArray request; // 线路上的原始帧，RTU含CRC，TCP含MBAP报文头
+    QByteArray response;
+    bool isFinal = true; // false表示请求仍在等待响应(如收到其他从站的帧)，该记录不计为一次请求
+};
+
+Q_DECLARE_METATYPE(ModbusTransactionRecord)
+
+// 单个从站的累计计数
+struct ModbusTransactionCounters
+{
+    quint64 requestCount = 0;
+    quint64 successCount = 0;
+    quint64 exceptionCount = 0;
+    quint64 invalidResponseCount = 0;
+    quint64 timeoutCount = 0;
+    quint64 crcErrorCount = 0;
+};
+
+class ModbusTransactionLog
+{
+public:
+    // 构造函数和析构函数
+    explicit ModbusTransactionLog(int capacity = DEFAULT_CAPACITY);
+    ~ModbusTransactionLog() = default;
+
+    void append(const ModbusTransactionRecord& record);
+    void clear();
+    // 按时间顺序访问，0为保留下来的最旧记录
+    const ModbusTransactionRecord& at(int index) const;
+    int size() const;
+    int capacity() const;
+    // 自构造或clear()以来追加的记录总数，包括已被覆盖的
+    quint64 getTotalCount() const;
+
+    ModbusTransactionCounters getCounters(int slaveId) const;
+    ModbusTransactionCounters getTotalCounters() const;
+    QList<int> getSlaveIds() const;
+
+private:
+    // 私有方法
+    static void count(ModbusTransactionCounters& counters, const ModbusTransactionRecord& record);
+
+    // 静态成员变量
+    static constexpr int DEFAULT_CAPACITY = 10000;
+
+    // 核心数据成员
+    QVector<ModbusTransactionRecord> m_records;
+    QMap<int, ModbusTransactionCounters> m_slaveCounters;
+    ModbusTransactionCounters m_totalCounters;
+
+    // 状态变量
+    int m_capacity;
+    int m_head = 0; // 最旧记录的位置
+    quint64 m_totalCount = 0;
+};
+
+#endif //MODBUSTRANSACTIONLOG_H
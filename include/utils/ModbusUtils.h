@@ -13,14 +13,56 @@
 #define MODBUSUTILS_H
 
 #include <QVariant>
+#include <QList>
+#include <QVector>
 #include <cstring> // for memcpy
 #include <QtGlobal>
+#include <QSerialPort>
 #include "utils/ModbusTag.h"
 
+// 预编译的解码步骤：一个点位在某个读请求响应中的位置和换算方式，生成请求时一并生成
+struct ModbusDecodeEntry
+{
+    int tagIndex = -1; // 目标点位在点位表中的下标
+    int offset = 0; // 在响应数据中的偏移(寄存器或位)
+    int width = 1; // 占用的寄存器数，位数据为1
+    bool isBit = false;
+    ModbusTag::DataType dataType = ModbusTag::DataType::UInt16;
+    ModbusTag::ByteOrder byteOrder = ModbusTag::ByteOrder::BigEndian;
+    double gain = 1.0;
+    double valueOffset = 0.0;
+};
+
+// RTU链路时序(ms)
+struct ModbusLinkTiming
+{
+    double byteTime = 0.0; // 每字节线路时间
+    double frameGap = 0.0; // 帧间静默时间
+};
+
 namespace ModbusUtils
 {
     quint32 reassemble32BitValue(quint16 reg1, quint16 reg2, ModbusTag::ByteOrder byteOrder);
     QVariant interpretRaw32BitValue(quint32 rawValue, ModbusTag::DataType dataType);
+    // 各数据区点位地址的起始编号：线圈00001、离散输入10001、输入寄存器30001、保持寄存器40001
+    int addressBase(int functionCode);
+    // 01/02/05/0F按位访问线圈和离散输入
+    bool isBitFunction(int functionCode);
+    // 点位占用的寄存器(或位)数量
+    int registerCount(const ModbusTag& tag);
+    // 单次读取的数量上限：位读取2000，寄存器读取125
+    int maxReadQuantity(int functionCode);
+    // 根据串口的波特率和字符帧格式计算链路时序，未配置时按9600 8N1计算
+    ModbusLinkTiming serialLinkTiming(const QSerialPort* port);
+    // 正常响应的RTU帧长度(含从站地址和CRC)，TCP帧长度为其加4
+    int rtuResponseSize(int functionCode, int quantity);
+    // 按低位对应低地址展开位数据，每个值为0或1
+    QList<quint16> unpackBits(const char* data, int count);
+    // 按高字节在前取出count个寄存器值
+    QList<quint16> unpackRegisters(const char* data, int count);
+    ModbusDecodeEntry compileDecodeEntry(const ModbusTag& tag, int tagIndex, int offset);
+    // 按解码步骤取出原始值并换算为工程值，响应数据不足时返回false
+    bool decodeValue(const ModbusDecodeEntry& entry, const QList<quint16>& values, double& value, quint32& rawValue);
 }
 
 #endif //MODBUSUTILS_H
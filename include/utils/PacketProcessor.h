@@ -35,13 +35,20 @@ public:
 
     // 供生产者(Serial/Tcp Manager)调用的公共接口
     void enqueueData(const DataPacket& packet);
+    // 供不经过数据包解析的数据源(如Modbus轮询)直接送入波形，可在任意线程调用
+    void publishWaveformBlock(const QString& channelName, const QVector<double>& timestamps,
+                              const QVector<double>& values);
 
 signals:
     // 串口显示数据信号
     void serialPortReceiveDataChanged(const QByteArray& data);
+    // 串口原始数据包信号，在处理线程中发出，用于原始字节捕获
+    void serialPortRawDataReceived(const DataPacket& packet);
     // TCP显示数据信号
     void tcpNetworkReceiveDataChanged(const QByteArray& data);
-    void waveformDataReady(const QString& channelName, const QVariantList& point);
+    // 波形数据块信号：同一数据包内同一通道的采样点合并为一块发送，QVector隐式共享，跨线程只增加引用计数
+    void waveformBlockReady(const QString& channelName, const QVector<double>& timestamps,
+                            const QVector<double>& values);
 
 protected:
     void run() override;
@@ -60,6 +67,16 @@ private:
     void processTcpDataWithScript(const DataPacket& packet);
     void processTcpDataWithoutScript(const DataPacket& packet);
 
+    // 波形数据块
+    struct WaveformBlock
+    {
+        QVector<double> timestamps;
+        QVector<double> values;
+    };
+    void appendWaveformPoint(QHash<QString, WaveformBlock>& blocks, const QString& channelId,
+                             const QString& channelName, double value);
+    void flushWaveformBlocks(QHash<QString, WaveformBlock>& blocks);
+
     static PacketProcessor* m_instance;
     static QMutex m_instanceMutex;
 
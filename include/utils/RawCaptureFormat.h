@@ -0,0 +1,71 @@
+/**
+  ******************************************************************************
+  * @file           : RawCaptureFormat.h
+  * @author         : wangxiangyu
+  * @brief          : 原始字节捕获文件格式(.sdtr)的编码与解码
+  * @attention      : 文件头："SDTR" + 版本(u16)；记录：方向(u8) + 来源长度(u8) + 时间戳(i64,µs) +
+  *                   数据长度(u32) + 来源 + 数据，全部为小端
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef RAWCAPTUREFORMAT_H
+#define RAWCAPTUREFORMAT_H
+
+#include <QByteArray>
+#include <QString>
+#include <QIODevice>
+#include <QFile>
+#include <QtGlobal>
+
+namespace RawCapture
+{
+    enum class Direction : quint8
+    {
+        Receive = 0,
+        Send = 1
+    };
+
+    struct Record
+    {
+        Direction direction = Direction::Receive;
+        qint64 timestamp = 0; // 微秒级Unix时间戳
+        QString source;
+        QByteArray data;
+    };
+
+    constexpr char FILE_MAGIC[4] = {'S', 'D', 'T', 'R'};
+    constexpr quint16 FILE_VERSION = 1;
+    constexpr qsizetype FILE_HEADER_SIZE = 6;
+    constexpr qsizetype RECORD_HEADER_SIZE = 14;
+    constexpr const char* FILE_SUFFIX = "sdtr";
+
+    QByteArray encodeFileHeader();
+    // 将一条记录追加到out，便于调用方复用缓冲区
+    void appendRecord(QByteArray& out, Direction direction, qint64 timestamp, const QString& source,
+                      const QByteArray& data);
+    QByteArray encodeRecord(Direction direction, qint64 timestamp, const QString& source, const QByteArray& data);
+    // 校验文件头(兼容映射方式写入的文件)，成功后device位于第一条记录处；
+    // 返回已提交数据的结束位置，映射文件只到已提交长度为止，失败返回-1
+    qint64 readFileHeader(QIODevice& device, QString& errorString);
+    // 读取下一条记录；到达dataEnd或记录不完整(写入中断)时返回false
+    bool readRecord(QIODevice& device, Record& record, qint64 dataEnd);
+
+    // 顺序读取捕获文件，未正常关闭的映射文件也只返回已提交的记录，且不修改文件
+    class Reader
+    {
+    public:
+        explicit Reader(const QString& fileName);
+
+        bool open();
+        bool readNext(Record& record);
+        QString errorString() const;
+
+    private:
+        QFile m_file;
+        qint64 m_dataEnd = -1;
+        QString m_errorString;
+    };
+}
+
+#endif //RAWCAPTUREFORMAT_H
@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file           : ReceiveDataExporter.h
+  * @author         : wangxiangyu
+  * @brief          : 接收区数据流式保存，在工作线程中按块写出记录快照
+  * @attention      : 快照在构造时创建，保存期间新接收的数据不影响本次保存
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef RECEIVEDATAEXPORTER_H
+#define RECEIVEDATAEXPORTER_H
+
+#include <QObject>
+#include <QFile>
+#include <atomic>
+#include "utils/ReceiveRecordStore.h"
+
+class ReceiveDataExporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    // 构造函数和析构函数
+    explicit ReceiveDataExporter(const QString& fileName, const ReceiveRecordFilter& filter = ReceiveRecordFilter(),
+                                 QObject* parent = nullptr);
+    ~ReceiveDataExporter() = default;
+
+    // 在工作线程中调用
+    void run();
+    // 可在任意线程调用
+    void cancel();
+
+signals:
+    void progressChanged(int percent);
+    void finished(bool success, const QString& message);
+
+private:
+    // 静态成员变量
+    static constexpr qint64 WRITE_CHUNK_SIZE = 1 << 20;
+
+    // 核心数据成员
+    QString m_fileName;
+    ReceiveRecordStore::Reader m_reader;
+
+    // 状态变量
+    std::atomic<bool> m_cancelled{false};
+};
+
+#endif //RECEIVEDATAEXPORTER_H
@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file           : ReceiveRecordStore.h
+  * @author         : wangxiangyu
+  * @brief          : 接收区数据记录存储，按块保存显示的每一行，支持快照后在工作线程中流式读取
+  * @attention      : 已写满的数据块不再修改，快照只复制块指针，不复制数据
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef RECEIVERECORDSTORE_H
+#define RECEIVERECORDSTORE_H
+
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+#include <QList>
+#include <QMutex>
+#include <memory>
+
+// 保存时的筛选条件
+struct ReceiveRecordFilter
+{
+    qint64 startTime = 0; // 毫秒级Unix时间戳，0为不限制
+    qint64 endTime = 0;
+    QString keyword;
+    Qt::CaseSensitivity caseSensitivity = Qt::CaseInsensitive;
+
+    bool isEmpty() const { return startTime == 0 && endTime == 0 && keyword.isEmpty(); }
+};
+
+class ReceiveRecordStore
+{
+public:
+    // 单条记录在块中的索引，文本保存在块的text中
+    struct RecordIndex
+    {
+        qint64 timestamp;
+        qint32 offset;
+        qint32 length;
+        bool isSent;
+    };
+
+    struct Chunk
+    {
+        QByteArray text;
+        QVector<RecordIndex> records;
+    };
+
+    // 某一时刻的只读快照
+    struct Snapshot
+    {
+        QList<std::shared_ptr<const Chunk>> chunks;
+        qint64 recordCount = 0;
+        qint64 byteCount = 0;
+        qint64 firstTimestamp = 0;
+        qint64 lastTimestamp = 0;
+    };
+
+    // 按筛选条件把快照逐块转为文本，每行以换行符结尾
+    class Reader
+    {
+    public:
+        Reader(Snapshot snapshot, ReceiveRecordFilter filter);
+
+        bool atEnd() const;
+        // 读取不超过maxBytes(至少一行)的文本
+        QByteArray readChunk(qint64 maxBytes);
+        qint64 getProcessedBytes() const;
+        qint64 getTotalBytes() const;
+        qint64 getMatchedRecords() const;
+
+    private:
+        bool matches(const Chunk& chunk, const RecordIndex& record) const;
+
+        Snapshot m_snapshot;
+        ReceiveRecordFilter m_filter;
+        QByteArray m_keyword;
+        qsizetype m_chunkIndex = 0;
+        qsizetype m_recordIndex = 0;
+        qint64 m_processedBytes = 0;
+        qint64 m_matchedRecords = 0;
+    };
+
+    static ReceiveRecordStore* getInstance();
+
+    // 拷贝控制
+    ReceiveRecordStore(const ReceiveRecordStore&) = delete;
+    ReceiveRecordStore& operator=(const ReceiveRecordStore&) = delete;
+
+    void append(const QString& text, bool isSent = false);
+    void clear();
+    Snapshot snapshot() const;
+    qint64 getByteCount() const;
+
+private:
+    // 构造函数和析构函数
+    ReceiveRecordStore() = default;
+    ~ReceiveRecordStore() = default;
+
+    // 私有方法
+    void sealCurrentChunk();
+
+    // 静态成员变量
+    static ReceiveRecordStore* m_pInstance;
+    static QMutex m_instanceMutex;
+    static constexpr qsizetype CHUNK_SIZE = 1024 * 1024;
+
+    // 核心数据成员
+    QList<std::shared_ptr<const Chunk>> m_sealedChunks;
+    Chunk m_currentChunk;
+
+    // 同步对象
+    mutable QMutex m_mutex;
+
+    // 状态变量
+    qint64 m_recordCount = 0;
+    qint64 m_byteCount = 0;
+    qint64 m_firstTimestamp = 0;
+    qint64 m_lastTimestamp = 0;
+};
+
+#endif //RECEIVERECORDSTORE_H
@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file           : WaveformDecimator.h
+  * @author         : wangxiangyu
+  * @brief          : 波形数据抽取：多级min/max金字塔与LTTB降采样
+  * @attention      : 金字塔按采样点下标分桶，要求数据按时间顺序追加
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef WAVEFORMDECIMATOR_H
+#define WAVEFORMDECIMATOR_H
+
+#include <QVector>
+#include <QtGlobal>
+
+// 金字塔中的一个桶，汇总连续若干个采样点
+struct WaveformBucket
+{
+    double startTime = 0.0;
+    double endTime = 0.0;
+    double minValue = 0.0;
+    double maxValue = 0.0;
+    double firstValue = 0.0;
+    double lastValue = 0.0;
+};
+
+// 多级min/max金字塔：第0级每桶BASE_BUCKET_SIZE个点，每升一级合并FANOUT个桶
+class WaveformPyramid
+{
+public:
+    static constexpr qsizetype BASE_BUCKET_SIZE = 256;
+    static constexpr qsizetype FANOUT = 4;
+    static constexpr int MAX_LEVELS = 8;
+
+    void append(double timestamp, double value);
+    void clear();
+
+    int getLevelCount() const { return m_levels.size(); }
+    qsizetype getSampleCount() const { return m_sampleCount; }
+    const QVector<WaveformBucket>& getBuckets(int level) const { return m_levels[level]; }
+    static qsizetype getBucketSize(int level);
+    // 选择桶大小不超过maxBucketSize的最粗一级，没有合适级别时返回-1
+    int selectLevel(qsizetype maxBucketSize) const;
+
+private:
+    QVector<QVector<WaveformBucket>> m_levels;
+    qsizetype m_sampleCount = 0;
+};
+
+namespace WaveformDecimator
+{
+    // Largest-Triangle-Three-Buckets 降采样，保留首尾点，输出不超过threshold个点
+    void lttb(const double* timestamps, const double* values, qsizetype count, qsizetype threshold,
+              QVector<double>& outTimestamps, QVector<double>& outValues);
+}
+
+#endif //WAVEFORMDECIMATOR_H
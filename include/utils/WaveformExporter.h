@@ -0,0 +1,85 @@
+/**
+  ******************************************************************************
+  * @file           : WaveformExporter.h
+  * @author         : wangxiangyu
+  * @brief          : 波形数据流式导出（CSV/二进制/JSON），在线程池中执行
+  * @attention      : 导出开始时对各通道点数做快照，导出过程中新追加的数据不包含在内
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef WAVEFORMEXPORTER_H
+#define WAVEFORMEXPORTER_H
+
+#include <QObject>
+#include <QFile>
+#include <QByteArray>
+#include <atomic>
+#include "utils/WaveformSampleStore.h"
+
+class WaveformExporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class Format
+    {
+        Csv,
+        Binary,
+        Json
+    };
+
+    // 二进制格式：文件头 MAGIC + VERSION(u32) + 通道数(u32)，
+    // 每个通道：名称长度(u32) + UTF-8名称 + 点数(u64) + 点数 * (时间戳double, 数值double)，全部小端
+    static constexpr char BINARY_MAGIC[4] = {'S', 'D', 'T', 'W'};
+    static constexpr quint32 BINARY_VERSION = 1;
+
+    // 构造函数和析构函数
+    explicit WaveformExporter(const QString& fileName, Format format, QObject* parent = nullptr);
+    ~WaveformExporter() = default;
+
+    // 在工作线程中调用
+    void run();
+    // 可在任意线程调用
+    void cancel();
+
+    static Format formatFromFileName(const QString& fileName);
+
+signals:
+    void progressChanged(int percent);
+    void finished(bool success, const QString& message);
+
+private:
+    // 私有方法
+    bool writeCsv(QFile& file);
+    bool writeBinary(QFile& file);
+    bool writeJson(QFile& file);
+    // 遍历一个通道的全部采样点，每读取一段回调一次；被取消时返回false
+    template <typename Func>
+    bool forEachChunk(const QString& name, qsizetype sampleCount, Func func);
+    bool flushBuffer(QFile& file, bool force = false);
+    void reportProgress();
+    // NaN和无穷大没有合法的文本表示，改为写出nonFiniteText(JSON为null，CSV为空字段)
+    static void appendNumber(QByteArray& buffer, double value, const char* nonFiniteText = "");
+    static QByteArray escapeJsonString(const QString& text);
+
+    // 静态成员变量
+    static constexpr qsizetype BUFFER_FLUSH_SIZE = 1 << 20;
+
+    // 核心数据成员
+    QString m_fileName;
+    Format m_format;
+    WaveformSampleStore* m_pStore = nullptr;
+    QStringList m_channelNames;
+    QVector<qsizetype> m_sampleCounts;
+    QByteArray m_buffer;
+    QString m_errorString;
+
+    // 状态变量
+    std::atomic<bool> m_cancelled{false};
+    qsizetype m_totalSamples = 0;
+    qsizetype m_writtenSamples = 0;
+    int m_lastPercent = -1;
+};
+
+#endif //WAVEFORMEXPORTER_H
@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * @file           : WaveformImporter.h
+  * @author         : wangxiangyu
+  * @brief          : 波形数据流式导入（CSV/二进制/JSON），在线程池中执行
+  * @attention      : 文件格式与WaveformExporter一致，按数据块直接写入WaveformSampleStore
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef WAVEFORMIMPORTER_H
+#define WAVEFORMIMPORTER_H
+
+#include <QObject>
+#include <QFile>
+#include <QHash>
+#include <QSet>
+#include <atomic>
+#include "utils/WaveformSampleStore.h"
+#include "utils/WaveformExporter.h"
+
+class WaveformImporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    // 构造函数和析构函数
+    explicit WaveformImporter(const QString& fileName, WaveformExporter::Format format, QObject* parent = nullptr);
+    ~WaveformImporter() = default;
+
+    // 在工作线程中调用
+    void run();
+    // 可在任意线程调用
+    void cancel();
+
+signals:
+    void channelFound(const QString& name);
+    void progressChanged(int percent);
+    // 已导入数据的最大时间戳与最大绝对值，用于边导入边显示概览
+    void dataRangeChanged(double maxTime, double maxAbs);
+    void finished(bool success, const QString& message);
+
+private:
+    // JSON解析状态：只支持导出格式 {"通道名":[[t,v],...],...}
+    enum class JsonState
+    {
+        ObjectStart,
+        KeyOrObjectEnd,
+        Key,
+        Colon,
+        ArrayStart,
+        PointOrArrayEnd,
+        PointStart,
+        PointTime,
+        PointComma,
+        PointValue,
+        PointEnd,
+        AfterPoint,
+        AfterChannel,
+        Done
+    };
+
+    // 每个通道待写入存储的采样点
+    struct PendingSamples
+    {
+        QVector<double> timestamps;
+        QVector<double> values;
+    };
+
+    // 私有方法
+    bool readCsv(QFile& file);
+    bool readBinary(QFile& file);
+    bool readJson(QFile& file);
+    bool parseCsvLine(const char* begin, const char* end);
+    // 解析buffer中的完整JSON片段，返回已消费的字节数；出错时返回-1
+    qsizetype parseJson(const QByteArray& buffer, bool atEnd);
+    void appendSample(const QString& name, double timestamp, double value);
+    void flushPending(bool force);
+    void reportProgress(qint64 position);
+    // nullText非空时，内容与之相同的字段(CSV空字段、JSON的null)解析为NaN
+    static bool parseNumber(const char* begin, const char* end, double& value, const char* nullText = nullptr);
+    static QString unescapeJsonString(const char* begin, const char* end);
+
+    // 静态成员变量
+    static constexpr qint64 READ_CHUNK_SIZE = 1 << 20;
+
+    // 核心数据成员
+    QString m_fileName;
+    WaveformExporter::Format m_format;
+    WaveformSampleStore* m_pStore = nullptr;
+    QHash<QString, PendingSamples> m_pending;
+    QSet<QString> m_channels;
+    QString m_errorString;
+
+    // JSON解析状态
+    JsonState m_jsonState = JsonState::ObjectStart;
+    QString m_jsonChannel;
+    double m_jsonTime = 0.0;
+    double m_jsonValue = 0.0;
+
+    // 状态变量
+    std::atomic<bool> m_cancelled{false};
+    qint64 m_fileSize = 0;
+    qsizetype m_importedSamples = 0;
+    double m_maxTime = 0.0;
+    double m_maxAbs = 0.0;
+    int m_lastPercent = -1;
+};
+
+#endif //WAVEFORMIMPORTER_H
@@ -0,0 +1,145 @@
+/**
+  ******************************************************************************
+  * @file           : WaveformSampleStore.h
+  * @author         : wangxiangyu
+  * @brief          : 波形采样数据存储（单例），按通道分块列式存储，供原生波形控件直接查询
+  * @attention      : 每个通道的时间戳按递增顺序追加；写满的旧数据块可溢出到内存映射的临时文件
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#ifndef WAVEFORMSAMPLESTORE_H
+#define WAVEFORMSAMPLESTORE_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QHash>
+#include <QMutex>
+#include <QReadWriteLock>
+#include <QTemporaryFile>
+#include <QDir>
+#include <QDebug>
+#include "utils/WaveformDecimator.h"
+
+// 一个像素列内的数据包络（min/max抽取结果）
+struct WaveformColumn
+{
+    double minValue = 0.0;
+    double maxValue = 0.0;
+    double firstValue = 0.0; // 列内第一个点，用于与上一列连线
+    double lastValue = 0.0; // 列内最后一个点，用于与下一列连线
+    bool valid = false;
+};
+
+class WaveformSampleStore
+{
+public:
+    // 静态工厂方法/单例方法
+    static WaveformSampleStore* getInstance();
+
+    // 拷贝控制
+    WaveformSampleStore(const WaveformSampleStore&) = delete;
+    WaveformSampleStore& operator=(const WaveformSampleStore&) = delete;
+
+    // 通道管理
+    void addChannel(const QString& name);
+    void removeChannel(const QString& name);
+    void clearChannel(const QString& name);
+    void clearAll();
+    bool hasChannel(const QString& name) const;
+    QStringList getChannelNames() const;
+
+    // 数据写入
+    void appendSamples(const QString& name, const double* timestamps, const double* values, qsizetype count);
+
+    // 溢出配置：开启后每个通道只在内存中保留最近MAX_RESIDENT_BLOCKS个已写满的块
+    void setSpillEnabled(bool enabled);
+    bool isSpillEnabled() const;
+
+    // 数据查询
+    qsizetype getSampleCount(const QString& name) const;
+    qsizetype getSampleCount(const QString& name, double startTime, double endTime) const;
+    bool getTimeRange(const QString& name, double& minTime, double& maxTime) const;
+    bool getValueRange(const QString& name, double startTime, double endTime, double& minValue,
+                       double& maxValue) const;
+    bool getValueAt(const QString& name, double time, double& sampleTime, double& value) const;
+    // 按像素列做min/max抽取，columns为列数；数据密集时直接读取金字塔的汇总桶
+    QVector<WaveformColumn> queryColumns(const QString& name, double startTime, double endTime, int columns) const;
+    // 取出时间窗口内的原始点（含窗口两侧各一个点，便于连线到边界）
+    void querySamples(const QString& name, double startTime, double endTime, QVector<double>& timestamps,
+                      QVector<double>& values) const;
+    // 取出时间窗口内的点，超过maxPoints时用LTTB降采样
+    void queryDisplaySamples(const QString& name, double startTime, double endTime, qsizetype maxPoints,
+                             QVector<double>& timestamps, QVector<double>& values) const;
+    // 按下标分段读取，供导出等需要遍历全部历史的场景使用，返回实际读取的点数
+    qsizetype readSamples(const QString& name, qsizetype firstIndex, qsizetype maxCount,
+                          QVector<double>& timestamps, QVector<double>& values) const;
+
+    // 静态成员变量
+    static constexpr qsizetype BLOCK_SIZE = 65536; // 每块采样点数，时间戳与数值各占512KB
+    static constexpr int MAX_RESIDENT_BLOCKS = 8;
+
+private:
+    // 构造函数和析构函数
+    WaveformSampleStore() = default;
+    ~WaveformSampleStore() = default;
+
+    // 数据块：未溢出时数据在两个QVector中，溢出后指向映射区域
+    struct Block
+    {
+        double startTime = 0.0;
+        double endTime = 0.0;
+        double minValue = 0.0;
+        double maxValue = 0.0;
+        qsizetype count = 0;
+        QVector<double> timestamps;
+        QVector<double> values;
+        uchar* mapping = nullptr;
+        qint64 spillOffset = -1; // 在溢出文件中的位置
+
+        const double* timeData() const;
+        const double* valueData() const;
+    };
+
+    struct ChannelData
+    {
+        QVector<Block> blocks;
+        qsizetype sampleCount = 0;
+        qsizetype firstResidentBlock = 0; // 之前的块都已溢出，溢出时从这里开始检查
+        WaveformPyramid pyramid; // 全分辨率数据保留在数据块中，金字塔只用于缩略查询
+    };
+
+    // 以下方法均要求调用方已持有锁
+    // 查找时间窗口对应的下标区间 [first, last)
+    static void findRange(const ChannelData& channel, double startTime, double endTime, qsizetype& first,
+                          qsizetype& last);
+    static qsizetype lowerBound(const ChannelData& channel, double time);
+    static qsizetype upperBound(const ChannelData& channel, double time);
+    // 遍历下标区间 [first, last) 内的连续内存段
+    template <typename Func>
+    static void forEachSegment(const ChannelData& channel, qsizetype first, qsizetype last, Func func);
+    static void copyRange(const ChannelData& channel, qsizetype first, qsizetype last, QVector<double>& timestamps,
+                          QVector<double>& values);
+    void spillBlocks(ChannelData& channel);
+    void releaseChannel(ChannelData& channel);
+
+    // 静态成员变量
+    static WaveformSampleStore* m_pInstance;
+    static QMutex m_mutex;
+
+    // 核心数据成员
+    QHash<QString, ChannelData> m_channels;
+
+    // 溢出文件
+    QTemporaryFile m_spillFile;
+    qint64 m_spillFileSize = 0;
+    QVector<qint64> m_freeSpillSlots; // 已释放的块位置，溢出时优先复用
+    int m_spilledBlockCount = 0;
+    bool m_spillEnabled = true;
+
+    // 同步对象
+    mutable QReadWriteLock m_lock;
+};
+
+#endif //WAVEFORMSAMPLESTORE_H
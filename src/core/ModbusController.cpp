@@ -11,83 +11,201 @@
 #include "core/ModbusController.h"
 
 ModbusController::ModbusController(SerialPortManager* serialPortManager, QObject* parent)
-    : QObject(parent), m_pSerialPortManager(serialPortManager)
+    : QObject(parent), m_pSerialPortManager(serialPortManager), m_pTcpNetworkManager(TcpNetworkManager::getInstance())
 {
+    m_clock.start();
     this->connectSignals();
 }
 
-void ModbusController::readHoldingRegister(int slaveId, int startAddress, int quantity)
+int ModbusController::read(int slaveId, int functionCode, int startAddress, int quantity)
 {
-    if (!m_pSerialPortManager || !m_pSerialPortManager->getSerialPort()->isOpen())
+    if (functionCode < 0x01 || functionCode > 0x04)
     {
-        emit errorOccurred("串口未打开");
-        return;
-    }
-    // 如果上一个请求还未收到响应，则认为它已经超时了
-    if (m_pResponseTimer->isActive()) m_pResponseTimer->stop();
-    // 记录当前请求状态
-    m_lastRequestSlaveId = slaveId;
-    m_lastRequestFuncCode = 0x03;
-    m_lastRequestAddress = startAddress;
-    m_lastRequestQuantity = quantity;
-    // 构造请求
-    QByteArray request = this->buildReadRequest(slaveId, startAddress, quantity);
-    m_pSerialPortManager->handleWriteDataFromModbus(request);
-    // 设置超时时间为1秒
-    m_pResponseTimer->start(1000);
-}
-
-void ModbusController::writeSingleRegister(int slaveId, int startAddress, quint16 value)
-{
-    if (!m_pSerialPortManager || !m_pSerialPortManager->getSerialPort()->isOpen())
-    {
-        emit errorOccurred("串口未打开");
-        return;
+        emit errorOccurred(QString("不支持的读取功能码 0x%1").arg(functionCode, 2, 16, QChar('0')).toUpper());
+        return -1;
     }
+    return this->sendRequest(makeTransaction(slaveId, functionCode, startAddress, quantity),
+                             this->buildReadPdu(functionCode, startAddress, quantity));
+}
+
+int ModbusController::readHoldingRegister(int slaveId, int startAddress, int quantity)
+{
+    return this->read(slaveId, 0x03, startAddress, quantity);
+}
+
+int ModbusController::writeSingleCoil(int slaveId, int address, bool value)
+{
+    return this->sendRequest(makeTransaction(slaveId, 0x05, address, 1),
+                             this->buildWriteSingleCoilPdu(address, value));
+}
+
+int ModbusController::writeMultipleCoils(int slaveId, int startAddress, const QList<bool>& values)
+{
+    return this->sendRequest(makeTransaction(slaveId, 0x0F, startAddress, values.size()),
+                             this->buildWriteMultipleCoilsPdu(startAddress, values));
+}
+
+int ModbusController::writeSingleRegister(int slaveId, int startAddress, quint16 value)
+{
+    return this->sendRequest(makeTransaction(slaveId, 0x06, startAddress, 1),
+                             this->buildWriteSinglePdu(startAddress, value));
+}
+
+int ModbusController::writeMultipleRegisters(int slaveId, int startAddress, const QList<quint16>& values)
+{
+    return this->sendRequest(makeTransaction(slaveId, 0x10, startAddress, values.size()),
+                             this->buildWriteMultiplePdu(startAddress, values));
+}
+
+int ModbusController::readWriteMultipleRegisters(int slaveId, int readAddress, int readQuantity, int writeAddress,
+                                                 const QList<quint16>& values)
+{
+    Transaction transaction = makeTransaction(slaveId, 0x17, readAddress, readQuantity);
+    transaction.writeAddress = writeAddress;
+    return this->sendRequest(transaction,
+                             this->buildReadWriteMultiplePdu(readAddress, readQuantity, writeAddress, values));
+}
+
+void ModbusController::setTransport(Transport transport)
+{
+    if (m_transport == transport) return;
+    m_transport = transport;
+    // 另一条链路上的残留数据和在途请求都已无意义
+    m_buffer.clear();
+    m_rtuParser.clear();
+    m_transactions.clear();
+    m_slaveLinks.clear();
+    m_pResponseTimer->stop();
+}
+
+ModbusController::Transport ModbusController::getTransport() const
+{
+    return m_transport;
+}
+
+void ModbusController::setMaxInFlight(int count)
+{
+    m_maxInFlight = qBound(1, count, MAX_IN_FLIGHT);
+}
+
+int ModbusController::getMaxInFlight() const
+{
+    return m_maxInFlight;
+}
+
+bool ModbusController::canSendRequest() const
+{
+    const int window = m_transport == Transport::Tcp ? m_maxInFlight : 1;
+    return m_transactions.size() < window;
+}
+
+void ModbusController::setMaxRetries(int count)
+{
+    m_maxRetries = qBound(0, count, MAX_RETRIES);
+}
+
+int ModbusController::getMaxRetries() const
+{
+    return m_maxRetries;
+}
+
+bool ModbusController::isSlaveOnline(int slaveId) const
+{
+    auto it = m_slaveLinks.constFind(slaveId);
+    return it == m_slaveLinks.constEnd() || it->isOnline;
+}
 
-    if (m_pResponseTimer->isActive()) m_pResponseTimer->stop();
-    m_lastRequestSlaveId = slaveId;
-    m_lastRequestFuncCode = 0x06; // 功能码设为0x06
-    m_lastRequestAddress = startAddress;
-    // 构造请求
-    QByteArray request = this->buildWriteSingleRequest(slaveId, startAddress, value);
-    m_pSerialPortManager->handleWriteDataFromModbus(request);
-    m_pResponseTimer->start(1000); // 启动1秒超时定时器
+bool ModbusController::isTransportOpen() const
+{
+    if (m_transport == Transport::Tcp) return m_pTcpNetworkManager->isClientConnected();
+    return m_pSerialPortManager && m_pSerialPortManager->getSerialPort()->isOpen();
 }
 
-void ModbusController::writeMultipleRegisters(int slaveId, int startAddress, const QList<quint16>& values)
+QList<ModbusSlaveLinkStatistics> ModbusController::getSlaveStatistics() const
 {
-    if (!m_pSerialPortManager || !m_pSerialPortManager->getSerialPort()->isOpen())
+    QList<ModbusSlaveLinkStatistics> statistics;
+    for (auto it = m_slaveLinks.constBegin(); it != m_slaveLinks.constEnd(); ++it)
     {
-        emit errorOccurred("串口未打开");
-        return;
+        ModbusSlaveLinkStatistics item;
+        item.slaveId = it.key();
+        item.sampleCount = it->turnaround.getSampleCount();
+        item.p50 = it->turnaround.percentile(0.5);
+        item.p99 = it->turnaround.percentile(TIMEOUT_PERCENTILE);
+        item.timeoutMargin = this->timeoutMargin(it.value());
+        item.isOnline = it->isOnline;
+        item.timeoutCount = it->timeoutCount;
+        item.retryCount = it->retryCount;
+        statistics.append(item);
     }
+    return statistics;
+}
+
+void ModbusController::setPassive(bool passive)
+{
+    if (m_passive == passive) return;
+    m_passive = passive;
+    // 监听期间总线上的数据交给监听器解析，这里残留的半帧已无意义
+    m_rtuParser.clear();
+}
 
-    if (m_pResponseTimer->isActive()) m_pResponseTimer->stop();
-    m_lastRequestSlaveId = slaveId;
-    m_lastRequestFuncCode = 0x10; // 功能码设为0x10
-    m_lastRequestAddress = startAddress;
-    // 构造请求
-    QByteArray request = this->buildWriteMultipleRegisters(slaveId, startAddress, values);
-    m_pSerialPortManager->handleWriteDataFromModbus(request);
-    m_pResponseTimer->start(1000); // 启动1秒超时定时器
+bool ModbusController::isPassive() const
+{
+    return m_passive;
 }
 
 void ModbusController::onDataReceived(const QByteArray& data)
 {
+    if (m_transport != Transport::Rtu || m_passive) return;
     // 将新收到的数据追加的缓存中
-    m_buffer.append(data);
+    m_rtuParser.append(data);
     // 尝试解析缓存中的数据
     this->tryParseBuffer();
 }
 
+void ModbusController::onTcpDataReceived(const QByteArray& data)
+{
+    if (m_transport != Transport::Tcp) return;
+    m_buffer.append(data);
+    this->tryParseTcpBuffer();
+}
+
 void ModbusController::onResponseTimeout()
 {
-    if (m_lastRequestSlaveId != -1)
+    // 找出所有已到期的请求：在线从站在重试次数内重发，其余报告超时
+    const qint64 now = m_clock.elapsed();
+    QList<Transaction> retries;
+    QList<Transaction> failures;
+    for (auto it = m_transactions.begin(); it != m_transactions.end();)
     {
-        // 检查是否真的有一个请求在等待响应
-        emit errorOccurred(QString("从站 %1 响应超时").arg(m_lastRequestSlaveId));
-        m_lastRequestSlaveId = -1; // 清理状态
+        if (it.value().deadline > now)
+        {
+            ++it;
+            continue;
+        }
+        Transaction transaction = it.value();
+        it = m_transactions.erase(it);
+        this->logTransaction(transaction, ModbusTransactionRecord::Result::Timeout, m_clock.nsecsElapsed());
+        SlaveLink& link = m_slaveLinks[transaction.slaveId];
+        ++link.timeoutCount;
+        // 离线从站只做探测，不再重发
+        if (transaction.attempt < m_maxRetries && link.isOnline && this->isTransportOpen())
+        {
+            ++transaction.attempt;
+            ++link.retryCount;
+            retries.append(transaction);
+        }
+        else
+        {
+            failures.append(transaction);
+        }
+    }
+    for (const Transaction& transaction : qAsConst(retries)) this->transmit(transaction);
+    this->restartResponseTimer();
+    for (const Transaction& transaction : qAsConst(failures))
+    {
+        this->recordFailure(transaction.slaveId);
+        emit errorOccurred(QString("从站 %1 响应超时(已重试%2次)").arg(transaction.slaveId).arg(transaction.attempt));
+        emit requestCompleted(transaction.requestId, false);
     }
 }
 
@@ -98,196 +216,433 @@ void ModbusController::connectSignals()
     this->connect(m_pResponseTimer, &QTimer::timeout, this, &ModbusController::onResponseTimeout);
     this->connect(m_pSerialPortManager, &SerialPortManager::sendReadData2Modbus, this,
                   &ModbusController::onDataReceived);
+    this->connect(m_pTcpNetworkManager, &TcpNetworkManager::sendReadData2Modbus, this,
+                  &ModbusController::onTcpDataReceived);
 }
 
-QByteArray ModbusController::buildReadRequest(int slaveId, int startAddress, int quantity)
+bool ModbusController::isTransportReady()
 {
-    QByteArray request;
-    request.append(static_cast<char>(slaveId)); // 从站地址
-    request.append(static_cast<char>(0x03)); // 功能码
-    request.append(static_cast<char>((startAddress >> 8) & 0xFF)); // 起始地址 高位在前
-    request.append(static_cast<char>(startAddress & 0xFF));
-    request.append(static_cast<char>((quantity >> 8) & 0xFF)); // 读取数量 高位在前
-    request.append(static_cast<char>(quantity & 0xFF));
-    // CRC校验
-    quint16 crc = this->calculateCrc(request);
-    request.append(static_cast<char>(crc & 0xFF)); // crc 低位在前
-    request.append(static_cast<char>((crc >> 8) & 0xFF));
-    return request;
+    if (m_passive)
+    {
+        emit errorOccurred("总线监听模式下不能发送请求");
+        return false;
+    }
+    if (this->isTransportOpen()) return true;
+    emit errorOccurred(m_transport == Transport::Tcp ? "网络客户端未连接" : "串口未打开");
+    return false;
 }
 
-QByteArray ModbusController::buildWriteSingleRequest(int slaveId, int startAddress, quint16 value)
+int ModbusController::sendRequest(Transaction transaction, const QByteArray& pdu)
 {
-    QByteArray request;
-    request.append(static_cast<char>(slaveId)); // 从站地址
-    request.append(static_cast<char>(0x06)); // 功能码
+    if (!this->isTransportReady()) return -1;
+    transaction.requestId = m_nextRequestId++;
+    transaction.pdu = pdu;
+    // 如果上一个RTU请求还未收到响应，则认为它已经超时了
+    if (m_transport == Transport::Rtu && m_transactions.contains(0))
+    {
+        const Transaction previous = m_transactions.take(0);
+        this->logTransaction(previous, ModbusTransactionRecord::Result::Timeout, m_clock.nsecsElapsed());
+        emit requestCompleted(previous.requestId, false);
+    }
+    this->transmit(transaction);
+    return transaction.requestId;
+}
+
+void ModbusController::transmit(Transaction transaction)
+{
+    transaction.wireTime = this->wireTime(transaction);
+    transaction.deadline = m_clock.elapsed() + this->responseTimeout(transaction);
+    transaction.sentAt = m_clock.nsecsElapsed();
+    if (m_transport == Transport::Tcp)
+    {
+        // 跳过仍在途的事务号，保证响应可以唯一匹配；重发时也换用新事务号，迟到的旧响应直接丢弃
+        quint16 transactionId = m_nextTransactionId++;
+        while (m_transactions.contains(transactionId)) transactionId = m_nextTransactionId++;
+        transaction.frame = this->buildTcpFrame(transactionId, transaction.slaveId, transaction.pdu);
+        m_transactions.insert(transactionId, transaction);
+        m_pTcpNetworkManager->handleWriteDataFromModbus(transaction.frame);
+    }
+    else
+    {
+        transaction.frame = this->buildRtuFrame(transaction.slaveId, transaction.pdu);
+        m_transactions.insert(0, transaction);
+        m_pSerialPortManager->handleWriteDataFromModbus(transaction.frame);
+    }
+    this->restartResponseTimer();
+}
+
+double ModbusController::wireTime(const Transaction& transaction) const
+{
+    // 以太网上的传输时间可以忽略
+    if (m_transport == Transport::Tcp) return 0.0;
+    const ModbusLinkTiming timing = ModbusUtils::serialLinkTiming(m_pSerialPortManager->getSerialPort());
+    const int requestSize = transaction.pdu.size() + 3; // 从站地址 + PDU + CRC
+    const int responseSize = ModbusUtils::rtuResponseSize(transaction.functionCode, transaction.quantity);
+    return (requestSize + responseSize) * timing.byteTime + 2 * timing.frameGap;
+}
+
+int ModbusController::responseTimeout(const Transaction& transaction) const
+{
+    const int margin = this->timeoutMargin(m_slaveLinks.value(transaction.slaveId));
+    return qCeil(transaction.wireTime) + margin;
+}
+
+int ModbusController::timeoutMargin(const SlaveLink& link) const
+{
+    // 样本不足时使用保守的固定余量，之后按p99留出余量，慢从站不会被误判、快从站掉线也能很快发现
+    if (link.turnaround.getSampleCount() < MIN_RTT_SAMPLES) return RESPONSE_TIMEOUT;
+    const double p99 = link.turnaround.percentile(TIMEOUT_PERCENTILE);
+    const double margin = qMax(p99 * TIMEOUT_PERCENTILE_FACTOR, p99 + MIN_TIMEOUT_MARGIN);
+    return qBound(MIN_TIMEOUT_MARGIN, qCeil(margin), MAX_TIMEOUT_MARGIN);
+}
+
+void ModbusController::recordResponse(const Transaction& transaction)
+{
+    SlaveLink& link = m_slaveLinks[transaction.slaveId];
+    const double elapsed = (m_clock.nsecsElapsed() - transaction.sentAt) / 1e6;
+    link.turnaround.addSample(qMax(0.0, elapsed - transaction.wireTime));
+    link.consecutiveFailures = 0;
+    if (link.isOnline) return;
+    link.isOnline = true;
+    emit slaveStatusChanged(transaction.slaveId, true);
+}
+
+void ModbusController::recordFailure(int slaveId)
+{
+    SlaveLink& link = m_slaveLinks[slaveId];
+    ++link.consecutiveFailures;
+    if (!link.isOnline || link.consecutiveFailures < OFFLINE_THRESHOLD) return;
+    link.isOnline = false;
+    emit slaveStatusChanged(slaveId, false);
+}
+
+void ModbusController::logTransaction(const Transaction& transaction, ModbusTransactionRecord::Result result,
+                                      qint64 finishedAt, const QByteArray& response, int exceptionCode,
+                                      bool isFinal)
+{
+    // 帧数据隐式共享，记录只增加引用计数，不复制
+    ModbusTransactionRecord record;
+    record.timestamp = QDateTime::currentMSecsSinceEpoch();
+    record.slaveId = transaction.slaveId;
+    record.functionCode = transaction.functionCode;
+    record.address = transaction.address;
+    record.quantity = transaction.quantity;
+    record.latency = (finishedAt - transaction.sentAt) / 1e6;
+    record.result = result;
+    record.exceptionCode = exceptionCode;
+    record.attempt = transaction.attempt;
+    record.request = transaction.frame;
+    record.response = response;
+    record.isFinal = isFinal;
+    emit transactionLogged(record);
+}
+
+ModbusController::Transaction ModbusController::makeTransaction(int slaveId, int functionCode, int address,
+                                                                int quantity)
+{
+    Transaction transaction;
+    transaction.slaveId = slaveId;
+    transaction.functionCode = functionCode;
+    transaction.address = address;
+    transaction.quantity = quantity;
+    return transaction;
+}
+
+QByteArray ModbusController::buildReadPdu(int functionCode, int startAddress, int quantity)
+{
+    QByteArray pdu;
+    pdu.append(static_cast<char>(functionCode)); // 功能码
+    pdu.append(static_cast<char>((startAddress >> 8) & 0xFF)); // 起始地址 高位在前
+    pdu.append(static_cast<char>(startAddress & 0xFF));
+    pdu.append(static_cast<char>((quantity >> 8) & 0xFF)); // 读取数量 高位在前
+    pdu.append(static_cast<char>(quantity & 0xFF));
+    return pdu;
+}
+
+QByteArray ModbusController::buildWriteSingleCoilPdu(int address, bool value)
+{
+    QByteArray pdu;
+    pdu.append(static_cast<char>(0x05)); // 功能码
+    pdu.append(static_cast<char>((address >> 8) & 0xFF));
+    pdu.append(static_cast<char>(address & 0xFF));
+    // 线圈值只能是0xFF00(ON)或0x0000(OFF)
+    pdu.append(static_cast<char>(value ? 0xFF : 0x00));
+    pdu.append(static_cast<char>(0x00));
+    return pdu;
+}
+
+QByteArray ModbusController::buildWriteMultipleCoilsPdu(int startAddress, const QList<bool>& values)
+{
+    QByteArray pdu;
+    pdu.append(static_cast<char>(0x0F)); // 功能码
+    pdu.append(static_cast<char>((startAddress >> 8) & 0xFF));
+    pdu.append(static_cast<char>(startAddress & 0xFF));
+    int quantity = values.size();
+    pdu.append(static_cast<char>((quantity >> 8) & 0xFF));
+    pdu.append(static_cast<char>(quantity & 0xFF));
+    // 每字节8个线圈，低位对应低地址
+    QByteArray bits((quantity + 7) / 8, '\0');
+    for (int i = 0; i < quantity; ++i)
+    {
+        if (values[i]) bits[i / 8] = static_cast<char>(bits[i / 8] | (1 << (i % 8)));
+    }
+    pdu.append(static_cast<char>(bits.size()));
+    pdu.append(bits);
+    return pdu;
+}
+
+QByteArray ModbusController::buildWriteSinglePdu(int address, quint16 value)
+{
+    QByteArray pdu;
+    pdu.append(static_cast<char>(0x06)); // 功能码
     // 寄存器地址
-    request.append(static_cast<char>((startAddress >> 8) & 0xFF));
-    request.append(static_cast<char>(startAddress & 0xFF));
+    pdu.append(static_cast<char>((address >> 8) & 0xFF));
+    pdu.append(static_cast<char>(address & 0xFF));
     // 要写入的值
-    request.append(static_cast<char>((value >> 8) & 0xFF));
-    request.append(static_cast<char>(value & 0xFF));
-    // CRC
-    quint16 crc = calculateCrc(request);
-    request.append(static_cast<char>(crc & 0xFF));
-    request.append(static_cast<char>((crc >> 8) & 0xFF));
-    return request;
+    pdu.append(static_cast<char>((value >> 8) & 0xFF));
+    pdu.append(static_cast<char>(value & 0xFF));
+    return pdu;
 }
 
-QByteArray ModbusController::buildWriteMultipleRegisters(int slaveId, int startAddress, const QList<quint16>& values)
+QByteArray ModbusController::buildWriteMultiplePdu(int startAddress, const QList<quint16>& values)
 {
-    QByteArray request;
-    request.append(static_cast<char>(slaveId)); // 1. 从站地址
-    request.append(static_cast<char>(0x10)); // 2. 功能码
+    QByteArray pdu;
+    pdu.append(static_cast<char>(0x10)); // 功能码
     // 起始地址
-    request.append(static_cast<char>((startAddress >> 8) & 0xFF));
-    request.append(static_cast<char>(startAddress & 0xFF));
+    pdu.append(static_cast<char>((startAddress >> 8) & 0xFF));
+    pdu.append(static_cast<char>(startAddress & 0xFF));
     // 寄存器数量
     int quantity = values.size();
     int byteCount = quantity * 2;
-    request.append(static_cast<char>((quantity >> 8) & 0xFF));
-    request.append(static_cast<char>(quantity & 0xFF));
+    pdu.append(static_cast<char>((quantity >> 8) & 0xFF));
+    pdu.append(static_cast<char>(quantity & 0xFF));
     // 字节数
-    request.append(static_cast<char>(byteCount));
+    pdu.append(static_cast<char>(byteCount));
     // 数据负载
     for (quint16 value : values)
     {
-        request.append(static_cast<char>((value >> 8) & 0xFF));
-        request.append(static_cast<char>(value & 0xFF));
+        pdu.append(static_cast<char>((value >> 8) & 0xFF));
+        pdu.append(static_cast<char>(value & 0xFF));
     }
-    // CRC
-    quint16 crc = calculateCrc(request);
-    request.append(static_cast<char>(crc & 0xFF));
-    request.append(static_cast<char>((crc >> 8) & 0xFF));
-    return request;
+    return pdu;
+}
+
+QByteArray ModbusController::buildReadWriteMultiplePdu(int readAddress, int readQuantity, int writeAddress,
+                                                       const QList<quint16>& values)
+{
+    QByteArray pdu;
+    pdu.append(static_cast<char>(0x17)); // 功能码
+    // 读起始地址和数量
+    pdu.append(static_cast<char>((readAddress >> 8) & 0xFF));
+    pdu.append(static_cast<char>(readAddress & 0xFF));
+    pdu.append(static_cast<char>((readQuantity >> 8) & 0xFF));
+    pdu.append(static_cast<char>(readQuantity & 0xFF));
+    // 写起始地址、数量和字节数
+    int writeQuantity = values.size();
+    pdu.append(static_cast<char>((writeAddress >> 8) & 0xFF));
+    pdu.append(static_cast<char>(writeAddress & 0xFF));
+    pdu.append(static_cast<char>((writeQuantity >> 8) & 0xFF));
+    pdu.append(static_cast<char>(writeQuantity & 0xFF));
+    pdu.append(static_cast<char>(writeQuantity * 2));
+    for (quint16 value : values)
+    {
+        pdu.append(static_cast<char>((value >> 8) & 0xFF));
+        pdu.append(static_cast<char>(value & 0xFF));
+    }
+    return pdu;
+}
+
+QByteArray ModbusController::buildRtuFrame(int slaveId, const QByteArray& pdu)
+{
+    QByteArray frame;
+    frame.append(static_cast<char>(slaveId)); // 从站地址
+    frame.append(pdu);
+    ModbusCrc::append(frame); // crc 低位在前
+    return frame;
+}
+
+QByteArray ModbusController::buildTcpFrame(quint16 transactionId, int slaveId, const QByteArray& pdu)
+{
+    // MBAP报文头：事务号、协议号(0)、后续字节数、单元标识，均为高位在前
+    QByteArray frame;
+    const int length = pdu.size() + 1;
+    frame.append(static_cast<char>((transactionId >> 8) & 0xFF));
+    frame.append(static_cast<char>(transactionId & 0xFF));
+    frame.append(static_cast<char>(0x00));
+    frame.append(static_cast<char>(0x00));
+    frame.append(static_cast<char>((length >> 8) & 0xFF));
+    frame.append(static_cast<char>(length & 0xFF));
+    frame.append(static_cast<char>(slaveId));
+    frame.append(pdu);
+    return frame;
 }
 
 void ModbusController::tryParseBuffer()
 {
-    bool processedOneFrame;
-    do
+    // 同一批数据中的多个CRC失败只报告一次，避免噪声刷屏
+    const qint64 crcErrorCount = m_rtuParser.getCrcErrorCount();
+    QByteArray frame;
+    while (m_rtuParser.nextFrame(frame))
     {
-        processedOneFrame = false;
-        if (m_buffer.length() < 5) break; // 缓冲区数据不足以构成一个最小帧
-        int frameLength = -1;
-        uint8_t functionCode = m_buffer[1];
-        // 根据功能码，判断一个完整帧的预期长度
-        if (functionCode & 0x80) // 异常响应
-        {
-            frameLength = 5;
-        }
-        else if (functionCode == 0x03) // 读响应
+        // 去掉从站地址后与TCP共用同一套处理流程；解析器已去掉CRC，记录时补回原始帧
+        QByteArray rawFrame = frame;
+        ModbusCrc::append(rawFrame);
+        // 其他从站的响应或共享总线上的其他帧不属于在途请求，记录后继续等待本从站的响应
+        auto it = m_transactions.constFind(0);
+        if (it != m_transactions.constEnd() && static_cast<quint8>(frame[0]) != it.value().slaveId)
         {
-            if (m_buffer.length() < 3) break; // 长度不足以读取字节数
-            int byteCount = static_cast<quint8>(m_buffer[2]);
-            frameLength = 3 + byteCount + 2;
-        }
-        else if (functionCode == 0x06 || functionCode == 0x10) // 写响应
-        {
-            frameLength = 8;
-        }
-        // 如果数据不足或者功能码未知，则不处理
-        if (frameLength == -1)
-        {
-            // 功能码与我们等待的不匹配，丢弃一个字节尝试重新同步
-            m_buffer.remove(0, 1);
-            processedOneFrame = true; // 认为处理过，继续循环
+            this->logTransaction(it.value(), ModbusTransactionRecord::Result::InvalidResponse, m_clock.nsecsElapsed(),
+                                 rawFrame, 0, false);
             continue;
         }
-        if (m_buffer.length() < frameLength) break; // 缓冲区数据不足以构成一个完整帧, 等待更多数据
-        // 提取完整帧并交给核心处理器
-        QByteArray frame = m_buffer.left(frameLength);
-        if (this->processFrame(frame))
+        this->processPdu(0, frame.mid(1), rawFrame);
+    }
+    if (m_rtuParser.getCrcErrorCount() == crcErrorCount) return;
+    // 校验失败的字节已被解析器丢弃，记录中只有请求帧
+    auto it = m_transactions.constFind(0);
+    if (it != m_transactions.constEnd())
+    {
+        for (qint64 i = crcErrorCount; i < m_rtuParser.getCrcErrorCount(); ++i)
+            this->logTransaction(it.value(), ModbusTransactionRecord::Result::CrcError, m_clock.nsecsElapsed());
+    }
+    emit errorOccurred("响应数据CRC校验失败");
+}
+
+void ModbusController::tryParseTcpBuffer()
+{
+    while (m_buffer.length() >= MBAP_HEADER_SIZE)
+    {
+        const quint16 protocolId = (static_cast<quint8>(m_buffer[2]) << 8) | static_cast<quint8>(m_buffer[3]);
+        const int length = (static_cast<quint8>(m_buffer[4]) << 8) | static_cast<quint8>(m_buffer[5]);
+        // 协议号必须为0，后续长度至少包含单元标识和功能码，且不超过一个ADU
+        if (protocolId != 0 || length < 2 || length > 254)
         {
-            m_buffer.remove(0, frameLength);
-            processedOneFrame = true; // 成功处理，继续循环是否还有下一帧
+            m_buffer.remove(0, 1); // 丢弃一个字节尝试重新同步
+            continue;
         }
-        else
+        const int frameLength = 6 + length;
+        if (m_buffer.length() < frameLength) break; // 等待更多数据
+        const quint16 transactionId = (static_cast<quint8>(m_buffer[0]) << 8) | static_cast<quint8>(m_buffer[1]);
+        const QByteArray frame = m_buffer.left(frameLength);
+        m_buffer.remove(0, frameLength);
+        // 单元标识与请求的从站不符：网关应答了错误的设备或其他连接的应答复用了事务号，记录后继续等待
+        auto it = m_transactions.constFind(transactionId);
+        if (it != m_transactions.constEnd() && static_cast<quint8>(frame[6]) != it.value().slaveId)
         {
-            // 如果处理失败，则丢弃一个字节尝试重新同步
-            m_buffer.remove(0, 1);
-            processedOneFrame = true;
+            this->logTransaction(it.value(), ModbusTransactionRecord::Result::InvalidResponse, m_clock.nsecsElapsed(),
+                                 frame, 0, false);
+            continue;
         }
+        this->processPdu(transactionId, frame.mid(MBAP_HEADER_SIZE), frame);
     }
-    while (processedOneFrame);
 }
 
-bool ModbusController::processFrame(const QByteArray& frame)
+void ModbusController::processPdu(quint16 transactionId, const QByteArray& pdu, const QByteArray& frame)
 {
-    // 收到完整帧，停止定时器
-    m_pResponseTimer->stop();
-    // CRC校验
-    int dataLength = frame.length() - 2;
-    quint16 receivedCrc = (static_cast<quint16>(static_cast<quint8>(frame[dataLength + 1])) << 8)
-        | static_cast<quint8>(frame[dataLength]);
-    if (this->calculateCrc(frame.left(dataLength)) != receivedCrc)
+    // 没有对应的在途请求，说明是超时后才到达的响应，直接丢弃
+    auto it = m_transactions.find(transactionId);
+    if (it == m_transactions.end()) return;
+    const Transaction transaction = it.value();
+    m_transactions.erase(it);
+    // 在分发数据之前取到达时间，耗时中不计入界面解码点位的时间
+    const qint64 receivedAt = m_clock.nsecsElapsed();
+    this->restartResponseTimer();
+    // 异常响应同样说明从站在线
+    this->recordResponse(transaction);
+    // 根据功能码处理数据
+    bool success = false;
+    auto result = ModbusTransactionRecord::Result::InvalidResponse;
+    int exceptionCode = 0;
+    uint8_t functionCode = pdu[0];
+    if (functionCode & 0x80)
     {
-        emit errorOccurred("响应数据CRC校验失败");
-        return false;
+        result = ModbusTransactionRecord::Result::Exception;
+        exceptionCode = pdu.length() > 1 ? static_cast<quint8>(pdu[1]) : 0;
+        this->handleExceptionResponse(transaction, pdu);
     }
-    // 根据功能码处理数据
-    uint8_t functionCode = frame[1];
-    if (functionCode & 0x80) this->handleExceptionResponse(frame);
-    else if (functionCode == 0x03) this->handleReadResponse(frame);
-    else if (functionCode == 0x06 || functionCode == 0x10) this->handleWriteResponse(frame);
-    else return false;
-    m_lastRequestSlaveId = -1;
-    return true;
+    else if (functionCode != transaction.functionCode)
+    {
+        emit errorOccurred("响应功能码与请求不匹配");
+    }
+    else if (functionCode <= 0x04 || functionCode == 0x17)
+    {
+        success = this->handleReadResponse(transaction, pdu);
+        if (success && functionCode <= 0x04)
+        {
+            const double elapsed = (receivedAt - transaction.sentAt) / 1e6;
+            emit responseTimeMeasured(transaction.slaveId, functionCode, transaction.quantity, elapsed);
+        }
+    }
+    else
+    {
+        success = this->handleWriteResponse(transaction, pdu);
+    }
+    if (success) result = ModbusTransactionRecord::Result::Success;
+    this->logTransaction(transaction, result, receivedAt, frame, exceptionCode);
+    emit requestCompleted(transaction.requestId, success);
 }
 
-void ModbusController::handleReadResponse(const QByteArray& frame)
+bool ModbusController::handleReadResponse(const Transaction& transaction, const QByteArray& pdu)
 {
-    int byteCount = static_cast<quint8>(frame[2]);
-    QList<quint16> values;
-    for (int i = 0; i < byteCount / 2; ++i)
+    int byteCount = pdu.length() > 1 ? static_cast<quint8>(pdu[1]) : 0;
+    if (pdu.length() < 2 + byteCount)
     {
-        quint8 highByte = frame[3 + 2 * i];
-        quint8 lowByte = frame[3 + 2 * i + 1];
-        values.append((highByte << 8) | lowByte);
+        emit errorOccurred("读取响应的数据长度不足");
+        return false;
     }
-    emit dataReady(m_lastRequestAddress, values);
+    // 位数据最后一个字节的高位补0，只取请求的数量
+    const QList<quint16> values = ModbusUtils::isBitFunction(transaction.functionCode)
+                                      ? ModbusUtils::unpackBits(pdu.constData() + 2,
+                                                                qMin(transaction.quantity, byteCount * 8))
+                                      : ModbusUtils::unpackRegisters(pdu.constData() + 2, byteCount / 2);
+    if (transaction.functionCode == 0x17)
+    {
+        // 写入部分没有单独的应答，收到回读数据即说明写入已执行
+        emit writeSuccessful(0x17, transaction.writeAddress + ModbusUtils::addressBase(0x17));
+        emit dataReady(transaction.requestId, 0x03, transaction.address, values);
+    }
+    else
+    {
+        emit dataReady(transaction.requestId, transaction.functionCode, transaction.address, values);
+    }
+    return true;
 }
 
-void ModbusController::handleWriteResponse(const QByteArray& frame)
+bool ModbusController::handleWriteResponse(const Transaction& transaction, const QByteArray& pdu)
 {
-    uint16_t respAddress = (static_cast<quint8>(frame[2]) << 8) | static_cast<quint8>(frame[3]);
-    if (respAddress != m_lastRequestAddress)
+    uint16_t respAddress = pdu.length() >= 3 ? (static_cast<quint8>(pdu[1]) << 8) | static_cast<quint8>(pdu[2]) : 0;
+    if (pdu.length() < 3 || respAddress != transaction.address)
     {
         emit errorOccurred("写入响应的地址与请求不匹配");
-        return;
+        return false;
     }
-    emit writeSuccessful(frame[1], m_lastRequestAddress + 40001);
+    const int displayAddress = transaction.address + ModbusUtils::addressBase(transaction.functionCode);
+    emit writeSuccessful(transaction.functionCode, displayAddress);
+    return true;
 }
 
-void ModbusController::handleExceptionResponse(const QByteArray& frame)
+void ModbusController::handleExceptionResponse(const Transaction& transaction, const QByteArray& pdu)
 {
-    if ((frame[1] & 0x7F) == m_lastRequestFuncCode)
+    if ((pdu[0] & 0x7F) == transaction.functionCode)
     {
-        int exceptionCode = static_cast<quint8>(frame[2]);
+        int exceptionCode = pdu.length() > 1 ? static_cast<quint8>(pdu[1]) : 0;
+        emit exceptionReceived(transaction.slaveId, transaction.functionCode, transaction.address,
+                               transaction.quantity, exceptionCode);
         emit errorOccurred(QString("Modbus异常: 功能码 0x%1, 异常码 0x%2")
-                           .arg(m_lastRequestFuncCode, 2, 16, QChar('0')).toUpper()
+                           .arg(transaction.functionCode, 2, 16, QChar('0')).toUpper()
                            .arg(exceptionCode, 2, 16, QChar('0')).toUpper());
     }
 }
 
-quint16 ModbusController::calculateCrc(const QByteArray& data)
+void ModbusController::restartResponseTimer()
 {
-    quint16 crc = 0xFFFF;
-    for (char byte : data)
+    if (m_transactions.isEmpty())
     {
-        crc ^= static_cast<quint8>(byte);
-        for (int i = 0; i < 8; ++i)
-        {
-            if (crc & 0x0001)
-            {
-                crc >>= 1;
-                crc ^= 0xA001;
-            }
-            else
-            {
-                crc >>= 1;
-            }
-        }
+        m_pResponseTimer->stop();
+        return;
     }
-    return crc;
+    qint64 earliest = std::numeric_limits<qint64>::max();
+    for (const Transaction& transaction : qAsConst(m_transactions))
+        earliest = qMin(earliest, transaction.deadline);
+    m_pResponseTimer->start(static_cast<int>(qMax<qint64>(0, earliest - m_clock.elapsed())));
 }
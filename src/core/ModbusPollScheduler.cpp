@@ -0,0 +1,221 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusPollScheduler.cpp
+  * @author         : wangxiangyu
+  * @brief          : Modbus轮询调度器实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "core/ModbusPollScheduler.h"
+
+// 构造函数和析构函数
+ModbusPollScheduler::ModbusPollScheduler(ModbusController* controller, QObject* parent)
+    : QObject(parent), m_pController(controller)
+{
+    m_pWakeTimer = new QTimer(this);
+    m_pWakeTimer->setSingleShot(true);
+    m_pWakeTimer->setTimerType(Qt::PreciseTimer);
+    m_pStatisticsTimer = new QTimer(this);
+    m_pStatisticsTimer->setInterval(STATISTICS_INTERVAL);
+    this->connect(m_pWakeTimer, &QTimer::timeout, this, &ModbusPollScheduler::dispatchNext);
+    this->connect(m_pStatisticsTimer, &QTimer::timeout, this, &ModbusPollScheduler::onStatisticsTimeout);
+    this->connect(m_pController, &ModbusController::dataReady, this, &ModbusPollScheduler::onDataReady);
+    this->connect(m_pController, &ModbusController::requestCompleted, this,
+                  &ModbusPollScheduler::onRequestCompleted);
+}
+
+void ModbusPollScheduler::setScanGroups(const QList<ModbusScanGroup>& groups)
+{
+    // 运行中替换请求集时，周期和优先级相同的组沿用原来的调度时间，新请求从下一个周期开始使用
+    QList<GroupState> previousGroups = m_groups;
+    m_groups.clear();
+    for (const ModbusScanGroup& group : groups)
+    {
+        if (group.requests.isEmpty()) continue;
+        GroupState state;
+        state.group = group;
+        for (const GroupState& previous : qAsConst(previousGroups))
+        {
+            if (previous.group.interval != group.interval || previous.group.priority != group.priority) continue;
+            state.nextDue = previous.nextDue;
+            state.completedCycles = previous.completedCycles;
+            state.achievedRate = previous.achievedRate;
+            break;
+        }
+        m_groups.append(state);
+    }
+    m_pendingRequests.clear();
+    if (m_isRunning) this->scheduleDispatch();
+}
+
+void ModbusPollScheduler::start()
+{
+    if (m_groups.isEmpty()) return;
+    m_clock.start();
+    m_statisticsClock.start();
+    for (GroupState& state : m_groups)
+    {
+        state.nextDue = 0;
+        state.nextRequest = 0;
+        state.inFlight = 0;
+        state.completedCycles = 0;
+        state.achievedRate = 0.0;
+    }
+    m_isRunning = true;
+    m_pendingRequests.clear();
+    m_nextProbe.clear();
+    m_pStatisticsTimer->start();
+    this->dispatchNext();
+}
+
+void ModbusPollScheduler::stop()
+{
+    m_isRunning = false;
+    m_pendingRequests.clear();
+    m_pWakeTimer->stop();
+    m_pStatisticsTimer->stop();
+}
+
+bool ModbusPollScheduler::isRunning() const
+{
+    return m_isRunning;
+}
+
+QList<ModbusScanGroupStatistics> ModbusPollScheduler::getStatistics() const
+{
+    QList<ModbusScanGroupStatistics> statistics;
+    for (const GroupState& state : m_groups)
+    {
+        ModbusScanGroupStatistics item;
+        item.interval = state.group.interval;
+        item.priority = state.group.priority;
+        item.requestCount = state.group.requests.size();
+        item.achievedRate = state.achievedRate;
+        statistics.append(item);
+    }
+    return statistics;
+}
+
+// private slots
+void ModbusPollScheduler::onDataReady(int requestId, int functionCode, int startAddress, const QList<quint16>& values)
+{
+    Q_UNUSED(functionCode);
+    Q_UNUSED(startAddress);
+    // 控制器先发出数据再发出完成通知，此时请求仍在在途表中
+    auto it = m_pendingRequests.constFind(requestId);
+    if (!m_isRunning || it == m_pendingRequests.constEnd()) return;
+    emit responseReady(m_groups[it->group].group.requests[it->request], values);
+}
+
+void ModbusPollScheduler::onRequestCompleted(int requestId, bool success)
+{
+    Q_UNUSED(success);
+    if (!m_isRunning) return;
+    // 手动读写或上一轮遗留请求的完成通知不影响扫描周期，但同样腾出了在途窗口
+    auto it = m_pendingRequests.find(requestId);
+    if (it != m_pendingRequests.end())
+    {
+        const int index = it.value().group;
+        m_pendingRequests.erase(it);
+        GroupState& state = m_groups[index];
+        --state.inFlight;
+        this->finishRequest(state);
+    }
+    // 响应处理仍在控制器的解析流程中，延后到事件循环再发送下一个请求
+    this->scheduleDispatch();
+}
+
+void ModbusPollScheduler::onStatisticsTimeout()
+{
+    const double seconds = m_statisticsClock.restart() / 1000.0;
+    if (seconds <= 0) return;
+    for (GroupState& state : m_groups)
+    {
+        state.achievedRate = state.completedCycles / seconds;
+        state.completedCycles = 0;
+    }
+    emit statisticsUpdated(this->getStatistics());
+}
+
+void ModbusPollScheduler::dispatchNext()
+{
+    m_dispatchPending = false;
+    if (!m_isRunning) return;
+    // 在控制器允许的在途窗口内尽量多地发出请求
+    while (m_pController->canSendRequest())
+    {
+        const qint64 now = m_clock.elapsed();
+        const int index = this->selectGroup(now);
+        if (index < 0)
+        {
+            // 没有可发送的请求，等到最近的到期时间；仍有请求在途时由其完成通知唤醒
+            if (!m_pendingRequests.isEmpty()) return;
+            qint64 earliest = std::numeric_limits<qint64>::max();
+            for (const GroupState& state : m_groups) earliest = qMin(earliest, state.nextDue);
+            m_pWakeTimer->start(static_cast<int>(qBound<qint64>(0, earliest - now, std::numeric_limits<int>::max())));
+            return;
+        }
+        GroupState& state = m_groups[index];
+        if (state.nextRequest == 0) state.cycleStart = now;
+        const ModbusReadRequest& request = state.group.requests[state.nextRequest];
+        if (!m_pController->isSlaveOnline(request.slaveId))
+        {
+            // 离线从站降级为定期探测，其余请求直接跳过，不让一个掉线设备拖慢整条总线
+            qint64& nextProbe = m_nextProbe[request.slaveId];
+            if (now < nextProbe)
+            {
+                ++state.nextRequest;
+                this->finishRequest(state);
+                continue;
+            }
+            nextProbe = now + PROBE_INTERVAL;
+        }
+        const int requestId = m_pController->read(request.slaveId, request.functionCode, request.startAddress,
+                                                  request.quantity);
+        if (requestId < 0)
+        {
+            // 链路不可用，稍后重试
+            m_pWakeTimer->start(RETRY_INTERVAL);
+            return;
+        }
+        m_pendingRequests.insert(requestId, {index, state.nextRequest});
+        ++state.nextRequest;
+        ++state.inFlight;
+    }
+}
+
+// 私有方法
+int ModbusPollScheduler::selectGroup(qint64 now) const
+{
+    // 已到期且本周期还有未发出请求的组中，优先级最高者优先，同优先级按到期时间先后
+    int selected = -1;
+    for (int i = 0; i < m_groups.size(); ++i)
+    {
+        const GroupState& state = m_groups[i];
+        if (state.nextDue > now || state.nextRequest >= state.group.requests.size()) continue;
+        if (selected < 0) selected = i;
+        const GroupState& best = m_groups[selected];
+        if (state.group.priority > best.group.priority ||
+            (state.group.priority == best.group.priority && state.nextDue < best.nextDue))
+            selected = i;
+    }
+    return selected;
+}
+
+void ModbusPollScheduler::finishRequest(GroupState& state)
+{
+    if (state.nextRequest < state.group.requests.size() || state.inFlight > 0) return;
+    // 一个扫描周期的所有请求都已完成，按周期开始时间计算下一次到期时间，落后时立即到期
+    state.nextRequest = 0;
+    ++state.completedCycles;
+    state.nextDue = state.cycleStart + state.group.interval;
+}
+
+void ModbusPollScheduler::scheduleDispatch()
+{
+    if (m_dispatchPending) return;
+    m_dispatchPending = true;
+    QMetaObject::invokeMethod(this, &ModbusPollScheduler::dispatchNext, Qt::QueuedConnection);
+}
@@ -0,0 +1,257 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusRequestPlanner.cpp
+  * @author         : wangxiangyu
+  * @brief          : 基于代价模型的Modbus读请求规划器实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "core/ModbusRequestPlanner.h"
+#include <algorithm>
+#include <limits>
+
+// 构造函数和析构函数
+ModbusRequestPlanner::ModbusRequestPlanner(ModbusController* controller, QObject* parent)
+    : QObject(parent), m_pController(controller)
+{
+    m_lastPlanTimer.start();
+    this->connect(m_pController, &ModbusController::responseTimeMeasured, this,
+                  &ModbusRequestPlanner::onResponseTimeMeasured);
+    this->connect(m_pController, &ModbusController::exceptionReceived, this,
+                  &ModbusRequestPlanner::onExceptionReceived);
+}
+
+QList<ModbusReadRequest> ModbusRequestPlanner::plan(const QList<ModbusTag>& tags, const QList<int>& tagIndices,
+                                                    double* estimatedTime)
+{
+    this->updateLinkModel();
+    // 收集待规划的点位，按(从站, 功能码, 起始地址)排序
+    QVector<PlanItem> items;
+    items.reserve(tagIndices.size());
+    for (int tagIndex : tagIndices)
+    {
+        const ModbusTag& tag = tags[tagIndex];
+        const int start = tag.address - ModbusUtils::addressBase(tag.functionCode);
+        const int end = start + ModbusUtils::registerCount(tag);
+        if (start < 0 || end > 65536) continue;
+        items.append({tagIndex, tag.slaveId, tag.functionCode, start, end});
+    }
+    std::sort(items.begin(), items.end(), [](const PlanItem& a, const PlanItem& b)
+    {
+        if (a.slaveId != b.slaveId) return a.slaveId < b.slaveId;
+        if (a.functionCode != b.functionCode) return a.functionCode < b.functionCode;
+        if (a.start != b.start) return a.start < b.start;
+        return a.end < b.end;
+    });
+    // 同一从站同一功能码的点位才能合并，逐段求解
+    QList<ModbusReadRequest> requests;
+    double totalTime = 0.0;
+    int segmentStart = 0;
+    for (int i = 1; i <= items.size(); ++i)
+    {
+        if (i < items.size() && items[i].slaveId == items[segmentStart].slaveId
+            && items[i].functionCode == items[segmentStart].functionCode)
+            continue;
+        this->planSegment(items.mid(segmentStart, i - segmentStart), tags, requests, totalTime);
+        m_plannedTurnaround.insert(items[segmentStart].slaveId, this->turnaround(items[segmentStart].slaveId));
+        segmentStart = i;
+    }
+    if (estimatedTime) *estimatedTime = totalTime;
+    m_replanPending = false;
+    m_lastPlanTimer.restart();
+    return requests;
+}
+
+void ModbusRequestPlanner::reset()
+{
+    m_turnaround.clear();
+    m_plannedTurnaround.clear();
+    m_illegalRanges.clear();
+}
+
+double ModbusRequestPlanner::estimateRequestTime(int slaveId, int functionCode, int quantity) const
+{
+    // TCP下多个请求同时在途，往返延迟被窗口内的请求分摊
+    const int window = m_isTcp ? m_pController->getMaxInFlight() : 1;
+    return this->wireTime(functionCode, quantity) + this->turnaround(slaveId) / window;
+}
+
+// private slots
+void ModbusRequestPlanner::onResponseTimeMeasured(int slaveId, int functionCode, int quantity, double elapsed)
+{
+    // 扣除模型中的线路时间，剩余部分视为从站处理和网络延迟
+    const double measured = qMax(0.0, elapsed - this->wireTime(functionCode, quantity));
+    auto it = m_turnaround.find(slaveId);
+    if (it == m_turnaround.end()) it = m_turnaround.insert(slaveId, measured);
+    else it.value() += SMOOTHING_FACTOR * (measured - it.value());
+    // 与规划时使用的值偏差较大时重新规划
+    auto planned = m_plannedTurnaround.constFind(slaveId);
+    if (planned == m_plannedTurnaround.constEnd()) return;
+    if (qAbs(it.value() - planned.value()) > qMax(1.0, planned.value() * REPLAN_THRESHOLD)) this->requestReplan();
+}
+
+void ModbusRequestPlanner::onExceptionReceived(int slaveId, int functionCode, int address, int quantity,
+                                               int exceptionCode)
+{
+    // 只关心读请求的0x02非法数据地址异常：之后不再跨越区间内的空隙地址合并，
+    // 区间内没有空隙时拆开其中的点位逐个读取，找出地址本身非法的点位
+    if (exceptionCode != 0x02 || functionCode < 0x01 || functionCode > 0x04) return;
+    QList<QPair<int, int>>& ranges = m_illegalRanges[areaKey(slaveId, functionCode)];
+    const QPair<int, int> range(address, address + quantity);
+    if (ranges.contains(range)) return;
+    ranges.append(range);
+    this->requestReplan();
+}
+
+// 私有方法
+void ModbusRequestPlanner::updateLinkModel()
+{
+    m_isTcp = m_pController->getTransport() == ModbusController::Transport::Tcp;
+    if (m_isTcp)
+    {
+        m_byteTime = TCP_BYTE_TIME;
+        m_frameGap = 0.0;
+        return;
+    }
+    const ModbusLinkTiming timing = ModbusUtils::serialLinkTiming(SerialPortManager::getInstance()->getSerialPort());
+    m_byteTime = timing.byteTime;
+    m_frameGap = timing.frameGap;
+}
+
+double ModbusRequestPlanner::wireTime(int functionCode, int quantity) const
+{
+    const int responseSize = ModbusUtils::rtuResponseSize(functionCode, quantity);
+    if (m_isTcp)
+    {
+        // 请求：MBAP(7) + PDU(5)；响应PDU与RTU相同，MBAP比从站地址+CRC多4字节
+        return (12 + responseSize + 4) * m_byteTime;
+    }
+    // 读请求固定8字节；两帧各需一个帧间静默
+    return (8 + responseSize) * m_byteTime + 2 * m_frameGap;
+}
+
+double ModbusRequestPlanner::turnaround(int slaveId) const
+{
+    return m_turnaround.value(slaveId, m_isTcp ? DEFAULT_TCP_TURNAROUND : DEFAULT_RTU_TURNAROUND);
+}
+
+void ModbusRequestPlanner::planSegment(const QVector<PlanItem>& items, const QList<ModbusTag>& tags,
+                                       QList<ModbusReadRequest>& requests, double& totalTime)
+{
+    if (items.isEmpty()) return;
+    const int slaveId = items.first().slaveId;
+    const int functionCode = items.first().functionCode;
+    const int maxQuantity = ModbusUtils::maxReadQuantity(functionCode);
+    QVector<int> holes;
+    QVector<bool> isolated;
+    this->collectConstraints(slaveId, functionCode, items, holes, isolated);
+    // best[j]为前j个点位的最短耗时，from[j]为最后一个请求的第一个点位
+    const int count = items.size();
+    QVector<double> best(count + 1, std::numeric_limits<double>::infinity());
+    QVector<int> from(count + 1, 0);
+    best[0] = 0.0;
+    for (int j = 1; j <= count; ++j)
+    {
+        int end = 0;
+        bool hasIsolated = false;
+        for (int i = j; i >= 1; --i)
+        {
+            // 向前扩展请求范围，跨度只增不减，超限、包含非法地址或需单独读取的点位后更早的起点也不可行
+            const int start = items[i - 1].start;
+            end = qMax(end, items[i - 1].end);
+            hasIsolated = hasIsolated || isolated[i - 1];
+            if (end - start > maxQuantity || (i < j && hasIsolated)) break;
+            auto hole = std::lower_bound(holes.cbegin(), holes.cend(), start);
+            if (hole != holes.cend() && *hole < end) break;
+            const double cost = best[i - 1] + this->estimateRequestTime(slaveId, functionCode, end - start);
+            if (cost < best[j])
+            {
+                best[j] = cost;
+                from[j] = i - 1;
+            }
+        }
+    }
+    totalTime += best[count];
+    // 回溯得到请求划分
+    QList<ModbusReadRequest> segmentRequests;
+    for (int j = count; j > 0; j = from[j])
+    {
+        ModbusReadRequest request{slaveId, items[from[j]].start, 0, functionCode};
+        int end = request.startAddress;
+        for (int k = from[j]; k < j; ++k)
+        {
+            end = qMax(end, items[k].end);
+            request.decodePlan.append(ModbusUtils::compileDecodeEntry(tags[items[k].tagIndex], items[k].tagIndex,
+                                                                      items[k].start - request.startAddress));
+        }
+        request.quantity = end - request.startAddress;
+        segmentRequests.prepend(request);
+    }
+    requests.append(segmentRequests);
+}
+
+void ModbusRequestPlanner::collectConstraints(int slaveId, int functionCode, const QVector<PlanItem>& items,
+                                              QVector<int>& holes, QVector<bool>& isolated) const
+{
+    holes.clear();
+    isolated.fill(false, items.size());
+    auto it = m_illegalRanges.constFind(areaKey(slaveId, functionCode));
+    if (it == m_illegalRanges.constEnd()) return;
+    // 单独读取仍返回异常的点位，其地址本身非法，始终单独读取，不拖累相邻点位
+    for (const QPair<int, int>& range : it.value())
+    {
+        for (int k = 0; k < items.size(); ++k)
+        {
+            if (range.first >= items[k].start && range.second <= items[k].end) isolated[k] = true;
+        }
+    }
+    QVector<int> unexplained;
+    for (const QPair<int, int>& range : it.value())
+    {
+        // 返回过非法地址异常的区间中，不属于任何点位的地址视为空洞
+        bool hasHole = false;
+        for (int address = range.first; address < range.second; ++address)
+        {
+            const bool covered = std::any_of(items.cbegin(), items.cend(), [address](const PlanItem& item)
+            {
+                return address >= item.start && address < item.end;
+            });
+            if (covered) continue;
+            holes.append(address);
+            hasHole = true;
+        }
+        if (hasHole) continue;
+        // 区间完全由点位覆盖且其中没有已知非法的点位：其中某个点位的地址非法，先拆开逐个读取
+        QVector<int> overlapping;
+        bool isExplained = false;
+        for (int k = 0; k < items.size(); ++k)
+        {
+            if (items[k].start >= range.second || items[k].end <= range.first) continue;
+            overlapping.append(k);
+            isExplained = isExplained || isolated[k];
+        }
+        if (!isExplained) unexplained.append(overlapping);
+    }
+    for (int k : qAsConst(unexplained)) isolated[k] = true;
+    std::sort(holes.begin(), holes.end());
+    holes.erase(std::unique(holes.begin(), holes.end()), holes.end());
+}
+
+void ModbusRequestPlanner::requestReplan()
+{
+    if (m_replanPending) return;
+    m_replanPending = true;
+    // 限制重新规划的频率，避免测量抖动导致请求集反复变化
+    const qint64 wait = qMax<qint64>(0, MIN_REPLAN_INTERVAL - m_lastPlanTimer.elapsed());
+    QTimer::singleShot(static_cast<int>(wait), this, [this]()
+    {
+        if (m_replanPending) emit planInvalidated();
+    });
+}
+
+quint32 ModbusRequestPlanner::areaKey(int slaveId, int functionCode)
+{
+    return (static_cast<quint32>(slaveId) << 8) | static_cast<quint32>(functionCode);
+}
@@ -0,0 +1,313 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusRtuSniffer.cpp
+  * @author         : wangxiangyu
+  * @brief          : Modbus RTU总线监听实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "core/ModbusRtuSniffer.h"
+
+// 构造函数和析构函数
+ModbusRtuSniffer::ModbusRtuSniffer(SerialPortManager* serialPortManager, QObject* parent)
+    : QObject(parent), m_pSerialPortManager(serialPortManager)
+{
+    m_pResponseTimer = new QTimer(this);
+    m_pResponseTimer->setSingleShot(true);
+    m_pResponseTimer->setInterval(RESPONSE_TIMEOUT);
+    this->connect(m_pResponseTimer, &QTimer::timeout, this, &ModbusRtuSniffer::onResponseTimeout);
+    this->connect(m_pSerialPortManager, &SerialPortManager::sendReadData2Modbus, this,
+                  &ModbusRtuSniffer::onDataReceived);
+}
+
+void ModbusRtuSniffer::start()
+{
+    m_buffer.clear();
+    m_readPos = 0;
+    m_gapPos = -1;
+    m_lastArrival = 0;
+    m_pending = PendingRequest();
+    m_frameCount = 0;
+    m_discardedBytes = 0;
+    m_isRunning = true;
+}
+
+void ModbusRtuSniffer::stop()
+{
+    m_isRunning = false;
+    m_pResponseTimer->stop();
+    m_pending = PendingRequest();
+    m_buffer.clear();
+    m_readPos = 0;
+}
+
+bool ModbusRtuSniffer::isRunning() const
+{
+    return m_isRunning;
+}
+
+quint64 ModbusRtuSniffer::getFrameCount() const
+{
+    return m_frameCount;
+}
+
+quint64 ModbusRtuSniffer::getDiscardedBytes() const
+{
+    return m_discardedBytes;
+}
+
+void ModbusRtuSniffer::onDataReceived(const QByteArray& data, qint64 timestamp)
+{
+    if (!m_isRunning || data.isEmpty()) return;
+    // 串口驱动按块交付数据，只能以块的到达时间估计静默：本块首字节开始传输的时间约为
+    // 到达时间减去本块的线路时间，与上一块到达时间之差超过帧间隔时，本块起点就是帧边界
+    if (m_lastArrival > 0 && m_readPos < m_buffer.size())
+    {
+        const ModbusLinkTiming timing = ModbusUtils::serialLinkTiming(m_pSerialPortManager->getSerialPort());
+        const double gap = (timestamp - m_lastArrival) / 1e6 - data.size() * timing.byteTime;
+        if (gap >= timing.frameGap) m_gapPos = m_buffer.size();
+    }
+    m_lastArrival = timestamp;
+    m_buffer.append(data);
+    this->parseBuffer(timestamp);
+    this->compact();
+}
+
+void ModbusRtuSniffer::onResponseTimeout()
+{
+    if (m_pending.isValid) this->finishPending(ModbusTransactionRecord::Result::Timeout, QByteArray(), now());
+}
+
+// 私有方法
+void ModbusRtuSniffer::parseBuffer(qint64 timestamp)
+{
+    while (m_readPos < m_buffer.size())
+    {
+        // 正在等待该从站的响应时优先按响应识别，否则优先按请求识别；CRC决定最终结果
+        const bool expectResponse = m_pending.isValid
+            && static_cast<quint8>(m_buffer[m_readPos]) == m_pending.slaveId;
+        bool needMore = false;
+        int length = 0;
+        bool isRequest = !expectResponse;
+        for (int i = 0; i < 2 && length <= 0; ++i)
+        {
+            if (i == 1) isRequest = !isRequest;
+            length = this->matchFrame(isRequest);
+            if (length == 0) needMore = true;
+        }
+        if (length > 0)
+        {
+            const QByteArray frame = m_buffer.mid(m_readPos, length);
+            m_readPos += length;
+            ++m_frameCount;
+            if (isRequest) this->handleRequest(frame, timestamp);
+            else this->handleResponse(frame, timestamp);
+            continue;
+        }
+        // 当前位置之后出现过帧间静默：候选帧跨过了静默却仍不完整或校验失败，直接跳到静默之后重新同步
+        if (m_gapPos > m_readPos)
+        {
+            m_discardedBytes += m_gapPos - m_readPos;
+            m_readPos = m_gapPos;
+            continue;
+        }
+        if (needMore) break; // 等待更多数据
+        // 无法识别的字节(噪声或监听开始时截断的帧)，逐字节重新同步
+        ++m_readPos;
+        ++m_discardedBytes;
+    }
+}
+
+int ModbusRtuSniffer::matchFrame(bool isRequest) const
+{
+    const char* data = m_buffer.constData() + m_readPos;
+    const qsizetype available = m_buffer.size() - m_readPos;
+    const quint8 slaveId = static_cast<quint8>(data[0]);
+    // 248以上为保留地址；广播请求(0)没有响应
+    if (slaveId > 247 || (!isRequest && slaveId == 0)) return -1;
+    const int length = isRequest ? ModbusRtuParser::requestLength(data, available)
+                                 : ModbusRtuParser::responseLength(data, available);
+    if (length <= 0) return length;
+    if (length > MAX_FRAME_SIZE) return -1;
+    if (length > available) return 0;
+    return ModbusCrc::verify(data, length) ? length : -1;
+}
+
+void ModbusRtuSniffer::handleRequest(const QByteArray& frame, qint64 timestamp)
+{
+    // 上一个请求在新请求出现前都没有响应
+    if (m_pending.isValid) this->finishPending(ModbusTransactionRecord::Result::Timeout, QByteArray(), timestamp);
+    const int slaveId = static_cast<quint8>(frame[0]);
+    const int functionCode = static_cast<quint8>(frame[1]);
+    if (slaveId == 0) return; // 广播请求没有响应，无从确认是否执行
+    PendingRequest pending;
+    pending.isValid = true;
+    pending.slaveId = slaveId;
+    pending.functionCode = functionCode;
+    pending.frame = frame;
+    pending.timestamp = timestamp;
+    switch (functionCode)
+    {
+    case 0x01:
+    case 0x02:
+    case 0x03:
+    case 0x04:
+    case 0x0F:
+    case 0x10:
+    case 0x17:
+        pending.address = readUInt16(frame.constData() + 2);
+        pending.quantity = readUInt16(frame.constData() + 4);
+        break;
+    case 0x05:
+    case 0x06:
+        pending.address = readUInt16(frame.constData() + 2);
+        pending.quantity = 1;
+        break;
+    default:
+        break;
+    }
+    m_pending = pending;
+    m_pResponseTimer->start();
+}
+
+void ModbusRtuSniffer::handleResponse(const QByteArray& frame, qint64 timestamp)
+{
+    const int slaveId = static_cast<quint8>(frame[0]);
+    const int functionCode = static_cast<quint8>(frame[1]);
+    // 没有对应请求的响应(监听开始前发出的请求)无法确定地址，只计入帧数
+    if (!m_pending.isValid || slaveId != m_pending.slaveId || (functionCode & 0x7F) != m_pending.functionCode) return;
+    if (functionCode & 0x80)
+    {
+        this->finishPending(ModbusTransactionRecord::Result::Exception, frame, timestamp,
+                            static_cast<quint8>(frame[2]));
+        return;
+    }
+    const char* payload = frame.constData() + 3;
+    const int byteCount = static_cast<quint8>(frame[2]);
+    switch (functionCode)
+    {
+    case 0x01:
+    case 0x02:
+        if (byteCount != (m_pending.quantity + 7) / 8) break;
+        emit valuesObserved(slaveId, functionCode, m_pending.address,
+                            ModbusUtils::unpackBits(payload, m_pending.quantity));
+        this->finishPending(ModbusTransactionRecord::Result::Success, frame, timestamp);
+        return;
+    case 0x03:
+    case 0x04:
+    case 0x17:
+        if (byteCount != m_pending.quantity * 2) break;
+        // 0x17先写后读，写入的值同样是数据区的新值
+        if (functionCode == 0x17) this->emitWrittenValues(m_pending.frame);
+        emit valuesObserved(slaveId, functionCode == 0x17 ? 0x03 : functionCode, m_pending.address,
+                            ModbusUtils::unpackRegisters(payload, m_pending.quantity));
+        this->finishPending(ModbusTransactionRecord::Result::Success, frame, timestamp);
+        return;
+    case 0x05:
+    case 0x06:
+    case 0x0F:
+    case 0x10:
+        // 写响应回显地址，确认后请求中的值才算写入
+        if (readUInt16(frame.constData() + 2) != m_pending.address) break;
+        this->emitWrittenValues(m_pending.frame);
+        this->finishPending(ModbusTransactionRecord::Result::Success, frame, timestamp);
+        return;
+    default:
+        // 其他功能码只记录事务，不涉及点位数据
+        this->finishPending(ModbusTransactionRecord::Result::Success, frame, timestamp);
+        return;
+    }
+    this->finishPending(ModbusTransactionRecord::Result::InvalidResponse, frame, timestamp);
+}
+
+void ModbusRtuSniffer::emitWrittenValues(const QByteArray& request)
+{
+    const char* data = request.constData();
+    const int slaveId = static_cast<quint8>(data[0]);
+    const int functionCode = static_cast<quint8>(data[1]);
+    const int address = readUInt16(data + 2);
+    switch (functionCode)
+    {
+    case 0x05:
+        emit valuesObserved(slaveId, 0x01, address, {static_cast<quint16>(static_cast<quint8>(data[4]) == 0xFF)});
+        break;
+    case 0x06:
+        emit valuesObserved(slaveId, 0x03, address, {static_cast<quint16>(readUInt16(data + 4))});
+        break;
+    case 0x0F:
+    {
+        const int quantity = readUInt16(data + 4);
+        if (static_cast<quint8>(data[6]) < (quantity + 7) / 8) break;
+        emit valuesObserved(slaveId, 0x01, address, ModbusUtils::unpackBits(data + 7, quantity));
+        break;
+    }
+    case 0x10:
+    {
+        const int quantity = readUInt16(data + 4);
+        if (static_cast<quint8>(data[6]) < quantity * 2) break;
+        emit valuesObserved(slaveId, 0x03, address, ModbusUtils::unpackRegisters(data + 7, quantity));
+        break;
+    }
+    case 0x17:
+    {
+        const int writeQuantity = readUInt16(data + 8);
+        if (static_cast<quint8>(data[10]) < writeQuantity * 2) break;
+        emit valuesObserved(slaveId, 0x03, readUInt16(data + 6), ModbusUtils::unpackRegisters(data + 11, writeQuantity));
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void ModbusRtuSniffer::finishPending(ModbusTransactionRecord::Result result, const QByteArray& response,
+                                     qint64 timestamp, int exceptionCode)
+{
+    ModbusTransactionRecord record;
+    record.timestamp = QDateTime::currentMSecsSinceEpoch();
+    record.slaveId = m_pending.slaveId;
+    record.functionCode = m_pending.functionCode;
+    record.address = m_pending.address;
+    record.quantity = m_pending.quantity;
+    record.latency = (timestamp - m_pending.timestamp) / 1e6;
+    record.result = result;
+    record.exceptionCode = exceptionCode;
+    record.request = m_pending.frame;
+    record.response = response;
+    m_pending = PendingRequest();
+    m_pResponseTimer->stop();
+    emit transactionLogged(record);
+}
+
+void ModbusRtuSniffer::compact()
+{
+    // 全部消费时直接清空；否则累积到阈值才搬移，避免每个数据块都移动剩余数据
+    if (m_readPos == m_buffer.size())
+    {
+        m_buffer.clear();
+    }
+    else if (m_readPos >= COMPACT_THRESHOLD)
+    {
+        m_buffer.remove(0, m_readPos);
+    }
+    else
+    {
+        return;
+    }
+    m_gapPos = m_gapPos > m_readPos ? m_gapPos - m_readPos : -1;
+    m_readPos = 0;
+}
+
+qint64 ModbusRtuSniffer::now()
+{
+    // 与串口数据的时间戳使用同一个单调时钟
+    const auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+int ModbusRtuSniffer::readUInt16(const char* data)
+{
+    return (static_cast<quint8>(data[0]) << 8) | static_cast<quint8>(data[1]);
+}
@@ -0,0 +1,553 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusSlaveSimulator.cpp
+  * @author         : wangxiangyu
+  * @brief          : 进程内Modbus从站仿真器实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "core/ModbusSlaveSimulator.h"
+
+#ifdef Q_OS_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+#endif
+
+// 构造函数和析构函数
+ModbusSlaveSimulator::ModbusSlaveSimulator(QObject* parent)
+    : QObject(parent)
+{
+    for (QVector<quint16>& area : m_areas) area.fill(0, AREA_SIZE);
+    m_validRanges.append(qMakePair(0, 9999));
+    // 子对象随仿真器一起移入工作线程
+    m_pJsEngine = new QJSEngine(this);
+    m_pUpdateTimer = new QTimer(this);
+    m_pStatisticsTimer = new QTimer(this);
+    this->connect(m_pUpdateTimer, &QTimer::timeout, this, &ModbusSlaveSimulator::onUpdateTimeout);
+    this->connect(m_pStatisticsTimer, &QTimer::timeout, this, &ModbusSlaveSimulator::onStatisticsTimeout);
+}
+
+ModbusSlaveSimulator::~ModbusSlaveSimulator()
+{
+    this->closePty();
+}
+
+bool ModbusSlaveSimulator::startPty()
+{
+    this->stop();
+#ifdef Q_OS_LINUX
+    int masterFd = ::posix_openpt(O_RDWR | O_NOCTTY);
+    char slaveName[128] = {};
+    if (masterFd < 0 || ::grantpt(masterFd) != 0 || ::unlockpt(masterFd) != 0
+        || ::ptsname_r(masterFd, slaveName, sizeof(slaveName)) != 0)
+    {
+        if (masterFd >= 0) ::close(masterFd);
+        emit errorOccurred(QString("创建伪终端失败: %1").arg(QString::fromLocal8Bit(::strerror(errno))));
+        return false;
+    }
+    int slaveFd = ::open(slaveName, O_RDWR | O_NOCTTY);
+    // 两端都设为原始模式，避免行规程回显应答或转换换行符
+    for (int fd : {masterFd, slaveFd})
+    {
+        termios attributes{};
+        if (fd < 0 || ::tcgetattr(fd, &attributes) != 0) continue;
+        ::cfmakeraw(&attributes);
+        ::tcsetattr(fd, TCSANOW, &attributes);
+    }
+    ::fcntl(masterFd, F_SETFL, ::fcntl(masterFd, F_GETFL) | O_NONBLOCK);
+    m_ptyMasterFd = masterFd;
+    m_ptySlaveFd = slaveFd;
+    m_pPtyNotifier = new QSocketNotifier(masterFd, QSocketNotifier::Read, this);
+    this->connect(m_pPtyNotifier, &QSocketNotifier::activated, this, &ModbusSlaveSimulator::onPtyReadyRead);
+    this->startCommon();
+    emit started(QString::fromLocal8Bit(slaveName));
+    return true;
+#else
+    emit errorOccurred("伪终端仿真仅支持Linux，请使用TCP模式");
+    return false;
+#endif
+}
+
+bool ModbusSlaveSimulator::startTcp(quint16 port)
+{
+    this->stop();
+    m_pTcpServer = new QTcpServer(this);
+    if (!m_pTcpServer->listen(QHostAddress::Any, port))
+    {
+        emit errorOccurred(QString("监听端口%1失败: %2").arg(port).arg(m_pTcpServer->errorString()));
+        delete m_pTcpServer;
+        m_pTcpServer = nullptr;
+        return false;
+    }
+    this->connect(m_pTcpServer, &QTcpServer::newConnection, this, &ModbusSlaveSimulator::onNewConnection);
+    this->startCommon();
+    emit started(QString("0.0.0.0:%1").arg(m_pTcpServer->serverPort()));
+    return true;
+}
+
+void ModbusSlaveSimulator::stop()
+{
+    if (!this->isRunning()) return;
+    this->closePty();
+    if (m_pTcpServer)
+    {
+        for (QTcpSocket* socket : m_tcpBuffers.keys())
+        {
+            socket->disconnect(this);
+            socket->abort();
+            socket->deleteLater();
+        }
+        m_tcpBuffers.clear();
+        m_pTcpServer->close();
+        m_pTcpServer->deleteLater();
+        m_pTcpServer = nullptr;
+    }
+    m_pUpdateTimer->stop();
+    m_pStatisticsTimer->stop();
+    m_rtuParser.clear();
+    this->onStatisticsTimeout();
+    emit stopped();
+}
+
+bool ModbusSlaveSimulator::isRunning() const
+{
+    return m_ptyMasterFd >= 0 || m_pTcpServer != nullptr;
+}
+
+void ModbusSlaveSimulator::setSlaveId(int slaveId)
+{
+    m_slaveId = slaveId;
+}
+
+void ModbusSlaveSimulator::setFaults(const ModbusSimulatorFaults& faults)
+{
+    m_faults = faults;
+    m_faults.maxLatency = qMax(m_faults.minLatency, m_faults.maxLatency);
+}
+
+void ModbusSlaveSimulator::setValidRanges(const QList<QPair<int, int>>& ranges)
+{
+    m_validRanges = ranges;
+}
+
+bool ModbusSlaveSimulator::addGenerator(int address, const QString& expression, QString* errorMessage)
+{
+    Generator generator;
+    if (!addressToArea(address, generator.area, generator.address))
+    {
+        if (errorMessage) *errorMessage = QString("地址%1不属于任何数据区").arg(address);
+        return false;
+    }
+    generator.function = m_pJsEngine->evaluate(QString("(function(t, n) { return (%1); })").arg(expression));
+    if (generator.function.isError() || !generator.function.isCallable())
+    {
+        if (errorMessage) *errorMessage = generator.function.toString();
+        return false;
+    }
+    m_generators.append(generator);
+    return true;
+}
+
+void ModbusSlaveSimulator::clearGenerators()
+{
+    m_generators.clear();
+}
+
+// private slots
+void ModbusSlaveSimulator::onPtyReadyRead()
+{
+#ifdef Q_OS_LINUX
+    char buffer[4096];
+    while (true)
+    {
+        ssize_t size = ::read(m_ptyMasterFd, buffer, sizeof(buffer));
+        if (size <= 0) break;
+        m_rtuParser.append(QByteArray(buffer, size));
+    }
+    QByteArray frame;
+    while (m_rtuParser.nextFrame(frame)) this->handleRtuFrame(frame);
+#endif
+}
+
+void ModbusSlaveSimulator::onNewConnection()
+{
+    while (m_pTcpServer->hasPendingConnections())
+    {
+        QTcpSocket* socket = m_pTcpServer->nextPendingConnection();
+        m_tcpBuffers.insert(socket, QByteArray());
+        this->connect(socket, &QTcpSocket::readyRead, this, &ModbusSlaveSimulator::onSocketReadyRead);
+        this->connect(socket, &QTcpSocket::disconnected, this, &ModbusSlaveSimulator::onSocketDisconnected);
+    }
+}
+
+void ModbusSlaveSimulator::onSocketReadyRead()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(this->sender());
+    if (!socket || !m_tcpBuffers.contains(socket)) return;
+    QByteArray& buffer = m_tcpBuffers[socket];
+    buffer.append(socket->readAll());
+    // MBAP头：事务号(2) 协议号(2) 长度(2) 单元号(1)，长度包含单元号和PDU
+    qsizetype offset = 0;
+    while (buffer.size() - offset >= 7)
+    {
+        const int length = readUInt16(buffer, static_cast<int>(offset) + 4);
+        if (length < 2 || length > 254)
+        {
+            // 长度非法时无法再定位帧边界，断开连接
+            buffer.clear();
+            socket->abort();
+            return;
+        }
+        if (buffer.size() - offset < 6 + length) break;
+        this->handleTcpFrame(socket, buffer.mid(offset, 6 + length));
+        offset += 6 + length;
+    }
+    buffer.remove(0, offset);
+}
+
+void ModbusSlaveSimulator::onSocketDisconnected()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(this->sender());
+    if (!socket) return;
+    m_tcpBuffers.remove(socket);
+    socket->deleteLater();
+}
+
+void ModbusSlaveSimulator::onUpdateTimeout()
+{
+    ++m_updateCount;
+    const QJSValueList arguments = {QJSValue(m_clock.elapsed() / 1000.0), QJSValue(static_cast<double>(m_updateCount))};
+    for (int i = 0; i < m_generators.size();)
+    {
+        const Generator& generator = m_generators[i];
+        QJSValue result = generator.function.call(arguments);
+        if (result.isError())
+        {
+            // 出错的生成器直接移除，避免每个周期重复报错
+            emit errorOccurred(QString("生成器执行失败，已移除: %1").arg(result.toString()));
+            m_generators.removeAt(i);
+            continue;
+        }
+        if (result.isArray())
+        {
+            const int length = result.property("length").toInt();
+            for (int k = 0; k < length; ++k)
+                this->writeValue(generator.area, generator.address + k, result.property(k));
+        }
+        else
+        {
+            this->writeValue(generator.area, generator.address, result);
+        }
+        ++i;
+    }
+}
+
+void ModbusSlaveSimulator::onStatisticsTimeout()
+{
+    m_statistics.requestRate = (m_statistics.requestCount - m_lastRequestCount) * 1000.0 / STATISTICS_INTERVAL;
+    m_lastRequestCount = m_statistics.requestCount;
+    emit statisticsUpdated(m_statistics);
+}
+
+// 私有方法
+void ModbusSlaveSimulator::startCommon()
+{
+    m_statistics = ModbusSimulatorStatistics();
+    m_lastRequestCount = 0;
+    m_updateCount = 0;
+    m_clock.start();
+    m_pUpdateTimer->start(UPDATE_INTERVAL);
+    m_pStatisticsTimer->start(STATISTICS_INTERVAL);
+}
+
+void ModbusSlaveSimulator::handleRtuFrame(const QByteArray& frame)
+{
+    const int unitId = static_cast<quint8>(frame[0]);
+    if (unitId != 0 && unitId != m_slaveId) return;
+    ++m_statistics.requestCount;
+    QByteArray pdu = this->processPdu(frame.mid(1));
+    // 广播请求只执行不应答
+    if (unitId == 0 || !this->applyFaults(pdu)) return;
+    QByteArray response;
+    response.reserve(pdu.size() + 3);
+    response.append(static_cast<char>(unitId));
+    response.append(pdu);
+    ModbusCrc::append(response);
+    if (m_faults.crcErrorRate > 0.0 && m_random.generateDouble() < m_faults.crcErrorRate)
+    {
+        response[response.size() - 1] = static_cast<char>(response.back() ^ 0xFF);
+        ++m_statistics.crcErrorCount;
+    }
+    this->sendDelayed([this, response]() { this->writePty(response); });
+}
+
+void ModbusSlaveSimulator::handleTcpFrame(QTcpSocket* socket, const QByteArray& frame)
+{
+    if (readUInt16(frame, 2) != 0) return; // 协议号必须为0
+    // TCP上单元号0和0xFF表示直接访问设备本身
+    const int unitId = static_cast<quint8>(frame[6]);
+    if (unitId != 0 && unitId != 0xFF && unitId != m_slaveId) return;
+    ++m_statistics.requestCount;
+    QByteArray pdu = this->processPdu(frame.mid(7));
+    if (!this->applyFaults(pdu)) return;
+    QByteArray response = frame.left(4);
+    appendUInt16(response, static_cast<quint16>(pdu.size() + 1));
+    response.append(static_cast<char>(unitId));
+    response.append(pdu);
+    QPointer<QTcpSocket> target(socket);
+    this->sendDelayed([target, response]()
+    {
+        if (target && target->state() == QAbstractSocket::ConnectedState) target->write(response);
+    });
+}
+
+QByteArray ModbusSlaveSimulator::processPdu(const QByteArray& pdu)
+{
+    if (pdu.isEmpty()) return QByteArray();
+    const quint8 functionCode = static_cast<quint8>(pdu[0]);
+    switch (functionCode)
+    {
+        case 0x01: return this->readBits(Coils, pdu);
+        case 0x02: return this->readBits(DiscreteInputs, pdu);
+        case 0x03: return this->readRegisters(HoldingRegisters, pdu);
+        case 0x04: return this->readRegisters(InputRegisters, pdu);
+        case 0x05: return this->writeSingleCoil(pdu);
+        case 0x06: return this->writeSingleRegister(pdu);
+        case 0x0F: return this->writeMultipleCoils(pdu);
+        case 0x10: return this->writeMultipleRegisters(pdu);
+        case 0x17: return this->readWriteMultipleRegisters(pdu);
+        default: return exceptionPdu(functionCode, 0x01);
+    }
+}
+
+QByteArray ModbusSlaveSimulator::readBits(Area area, const QByteArray& pdu)
+{
+    const quint8 functionCode = static_cast<quint8>(pdu[0]);
+    if (pdu.size() < 5) return exceptionPdu(functionCode, 0x03);
+    const int start = readUInt16(pdu, 1);
+    const int quantity = readUInt16(pdu, 3);
+    if (quantity < 1 || quantity > 2000) return exceptionPdu(functionCode, 0x03);
+    if (!this->isValidRange(start, quantity)) return exceptionPdu(functionCode, 0x02);
+    const int byteCount = (quantity + 7) / 8;
+    QByteArray response(2 + byteCount, '\0');
+    response[0] = static_cast<char>(functionCode);
+    response[1] = static_cast<char>(byteCount);
+    const QVector<quint16>& values = m_areas[area];
+    for (int i = 0; i < quantity; ++i)
+    {
+        if (values[start + i]) response[2 + i / 8] = static_cast<char>(response[2 + i / 8] | (1 << (i % 8)));
+    }
+    return response;
+}
+
+QByteArray ModbusSlaveSimulator::readRegisters(Area area, const QByteArray& pdu)
+{
+    const quint8 functionCode = static_cast<quint8>(pdu[0]);
+    if (pdu.size() < 5) return exceptionPdu(functionCode, 0x03);
+    const int start = readUInt16(pdu, 1);
+    const int quantity = readUInt16(pdu, 3);
+    if (quantity < 1 || quantity > 125) return exceptionPdu(functionCode, 0x03);
+    if (!this->isValidRange(start, quantity)) return exceptionPdu(functionCode, 0x02);
+    QByteArray response;
+    response.reserve(2 + quantity * 2);
+    response.append(static_cast<char>(functionCode));
+    response.append(static_cast<char>(quantity * 2));
+    const QVector<quint16>& values = m_areas[area];
+    for (int i = 0; i < quantity; ++i) appendUInt16(response, values[start + i]);
+    return response;
+}
+
+QByteArray ModbusSlaveSimulator::writeSingleCoil(const QByteArray& pdu)
+{
+    if (pdu.size() < 5) return exceptionPdu(0x05, 0x03);
+    const int address = readUInt16(pdu, 1);
+    const quint16 value = readUInt16(pdu, 3);
+    if (value != 0xFF00 && value != 0x0000) return exceptionPdu(0x05, 0x03);
+    if (!this->isValidRange(address, 1)) return exceptionPdu(0x05, 0x02);
+    m_areas[Coils][address] = value == 0xFF00 ? 1 : 0;
+    return pdu.left(5);
+}
+
+QByteArray ModbusSlaveSimulator::writeSingleRegister(const QByteArray& pdu)
+{
+    if (pdu.size() < 5) return exceptionPdu(0x06, 0x03);
+    const int address = readUInt16(pdu, 1);
+    if (!this->isValidRange(address, 1)) return exceptionPdu(0x06, 0x02);
+    m_areas[HoldingRegisters][address] = readUInt16(pdu, 3);
+    return pdu.left(5);
+}
+
+QByteArray ModbusSlaveSimulator::writeMultipleCoils(const QByteArray& pdu)
+{
+    if (pdu.size() < 6) return exceptionPdu(0x0F, 0x03);
+    const int start = readUInt16(pdu, 1);
+    const int quantity = readUInt16(pdu, 3);
+    const int byteCount = static_cast<quint8>(pdu[5]);
+    if (quantity < 1 || quantity > 1968 || byteCount != (quantity + 7) / 8 || pdu.size() < 6 + byteCount)
+        return exceptionPdu(0x0F, 0x03);
+    if (!this->isValidRange(start, quantity)) return exceptionPdu(0x0F, 0x02);
+    for (int i = 0; i < quantity; ++i)
+        m_areas[Coils][start + i] = (static_cast<quint8>(pdu[6 + i / 8]) >> (i % 8)) & 0x01;
+    return pdu.left(5);
+}
+
+QByteArray ModbusSlaveSimulator::writeMultipleRegisters(const QByteArray& pdu)
+{
+    if (pdu.size() < 6) return exceptionPdu(0x10, 0x03);
+    const int start = readUInt16(pdu, 1);
+    const int quantity = readUInt16(pdu, 3);
+    const int byteCount = static_cast<quint8>(pdu[5]);
+    if (quantity < 1 || quantity > 123 || byteCount != quantity * 2 || pdu.size() < 6 + byteCount)
+        return exceptionPdu(0x10, 0x03);
+    if (!this->isValidRange(start, quantity)) return exceptionPdu(0x10, 0x02);
+    for (int i = 0; i < quantity; ++i) m_areas[HoldingRegisters][start + i] = readUInt16(pdu, 6 + i * 2);
+    return pdu.left(5);
+}
+
+QByteArray ModbusSlaveSimulator::readWriteMultipleRegisters(const QByteArray& pdu)
+{
+    if (pdu.size() < 10) return exceptionPdu(0x17, 0x03);
+    const int readStart = readUInt16(pdu, 1);
+    const int readQuantity = readUInt16(pdu, 3);
+    const int writeStart = readUInt16(pdu, 5);
+    const int writeQuantity = readUInt16(pdu, 7);
+    const int byteCount = static_cast<quint8>(pdu[9]);
+    if (readQuantity < 1 || readQuantity > 125 || writeQuantity < 1 || writeQuantity > 121
+        || byteCount != writeQuantity * 2 || pdu.size() < 10 + byteCount)
+        return exceptionPdu(0x17, 0x03);
+    if (!this->isValidRange(readStart, readQuantity) || !this->isValidRange(writeStart, writeQuantity))
+        return exceptionPdu(0x17, 0x02);
+    // 协议规定先写后读
+    for (int i = 0; i < writeQuantity; ++i)
+        m_areas[HoldingRegisters][writeStart + i] = readUInt16(pdu, 10 + i * 2);
+    QByteArray response;
+    response.reserve(2 + readQuantity * 2);
+    response.append(static_cast<char>(0x17));
+    response.append(static_cast<char>(readQuantity * 2));
+    for (int i = 0; i < readQuantity; ++i) appendUInt16(response, m_areas[HoldingRegisters][readStart + i]);
+    return response;
+}
+
+bool ModbusSlaveSimulator::isValidRange(int start, int quantity) const
+{
+    const int end = start + quantity - 1;
+    if (end >= AREA_SIZE) return false;
+    // 请求区间必须被有效区间完整覆盖，相邻的有效区间可以拼接
+    int position = start;
+    bool advanced = true;
+    while (position <= end && advanced)
+    {
+        advanced = false;
+        for (const QPair<int, int>& range : m_validRanges)
+        {
+            if (position < range.first || position > range.second) continue;
+            position = range.second + 1;
+            advanced = true;
+            break;
+        }
+    }
+    return position > end;
+}
+
+bool ModbusSlaveSimulator::applyFaults(QByteArray& pdu)
+{
+    if (pdu.isEmpty()) return false;
+    if (m_faults.dropRate > 0.0 && m_random.generateDouble() < m_faults.dropRate)
+    {
+        ++m_statistics.dropCount;
+        return false;
+    }
+    if (m_faults.exceptionRate > 0.0 && m_random.generateDouble() < m_faults.exceptionRate)
+        pdu = exceptionPdu(static_cast<quint8>(pdu[0]) & 0x7F, 0x04);
+    if (static_cast<quint8>(pdu[0]) & 0x80) ++m_statistics.exceptionCount;
+    ++m_statistics.responseCount;
+    return true;
+}
+
+void ModbusSlaveSimulator::sendDelayed(const std::function<void()>& send)
+{
+    const int latency = m_faults.maxLatency > 0 ? m_random.bounded(m_faults.minLatency, m_faults.maxLatency + 1) : 0;
+    if (latency <= 0) send();
+    else QTimer::singleShot(latency, this, send);
+}
+
+void ModbusSlaveSimulator::writeValue(Area area, int address, const QJSValue& value)
+{
+    if (address < 0 || address >= AREA_SIZE) return;
+    if (area == Coils || area == DiscreteInputs)
+    {
+        m_areas[area][address] = value.toNumber() != 0.0 ? 1 : 0;
+        return;
+    }
+    // 负数按16位补码保存，超出范围的值截断低16位
+    m_areas[area][address] = static_cast<quint16>(qRound64(value.toNumber()) & 0xFFFF);
+}
+
+void ModbusSlaveSimulator::writePty(const QByteArray& data)
+{
+#ifdef Q_OS_LINUX
+    if (m_ptyMasterFd < 0) return;
+    qsizetype written = 0;
+    while (written < data.size())
+    {
+        ssize_t size = ::write(m_ptyMasterFd, data.constData() + written, data.size() - written);
+        if (size <= 0) break; // 主站长时间不读时伪终端缓冲区会满，丢弃剩余数据
+        written += size;
+    }
+#else
+    Q_UNUSED(data);
+#endif
+}
+
+void ModbusSlaveSimulator::closePty()
+{
+    if (m_pPtyNotifier)
+    {
+        m_pPtyNotifier->setEnabled(false);
+        delete m_pPtyNotifier;
+        m_pPtyNotifier = nullptr;
+    }
+#ifdef Q_OS_LINUX
+    if (m_ptySlaveFd >= 0) ::close(m_ptySlaveFd);
+    if (m_ptyMasterFd >= 0) ::close(m_ptyMasterFd);
+#endif
+    m_ptySlaveFd = -1;
+    m_ptyMasterFd = -1;
+}
+
+QByteArray ModbusSlaveSimulator::exceptionPdu(quint8 functionCode, quint8 exceptionCode)
+{
+    QByteArray pdu;
+    pdu.append(static_cast<char>(functionCode | 0x80));
+    pdu.append(static_cast<char>(exceptionCode));
+    return pdu;
+}
+
+quint16 ModbusSlaveSimulator::readUInt16(const QByteArray& data, int offset)
+{
+    return static_cast<quint16>((static_cast<quint8>(data[offset]) << 8) | static_cast<quint8>(data[offset + 1]));
+}
+
+void ModbusSlaveSimulator::appendUInt16(QByteArray& data, quint16 value)
+{
+    data.append(static_cast<char>(value >> 8));
+    data.append(static_cast<char>(value & 0xFF));
+}
+
+bool ModbusSlaveSimulator::addressToArea(int address, Area& area, int& protocolAddress)
+{
+    // 与点位表相同的地址约定：0xxxx线圈 1xxxx离散输入 3xxxx输入寄存器 4xxxx保持寄存器
+    if (address >= 1 && address <= 9999) area = Coils;
+    else if (address >= 10001 && address <= 19999) area = DiscreteInputs;
+    else if (address >= 30001 && address <= 39999) area = InputRegisters;
+    else if (address >= 40001 && address <= 49999) area = HoldingRegisters;
+    else return false;
+    protocolAddress = address - (address / 10000) * 10000 - 1;
+    return true;
+}
@@ -141,24 +141,32 @@ void SerialPortManager::onSerialPortRead()
     if (!m_pSerialPort || !m_pSerialPort->isOpen()) return;
     QMutexLocker locker(&m_bufferMutex);
     const QByteArray& readData = m_pSerialPort->readAll();
+    if (m_readBuffer.isEmpty()) m_readBufferTimestamp = QDateTime::currentMSecsSinceEpoch() * 1000;
     m_readBuffer.append(readData);
-    if (m_isUseModbus) emit sendReadData2Modbus(readData);
+    if (m_isUseModbus)
+    {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        emit sendReadData2Modbus(readData, std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
 }
 
 void SerialPortManager::onReadBufferTimeout()
 {
     QByteArray dataToProcess;
+    qint64 timestamp = 0;
     {
         // 使用互斥锁保护对缓冲区的读和清空操作
         QMutexLocker locker(&m_bufferMutex);
         if (m_readBuffer.isEmpty()) return;
         // 使用 swap 高效地取出数据，并清空原缓冲区，这比直接赋值更快
         dataToProcess.swap(m_readBuffer);
+        timestamp = m_readBufferTimestamp;
     } // 互斥锁在这里自动释放
     // 现在可以在无锁状态下，将取出的数据块发送给处理器
     DataPacket packet;
     packet.sourceInfo = m_pSerialPort->portName();
     packet.data = dataToProcess;
+    packet.timestamp = timestamp;
 
     PacketProcessor::getInstance()->enqueueData(packet);
 }
@@ -211,7 +219,9 @@ void SerialPortManager::serialPortWrite(const QByteArray& data)
     if (bytesWritten == -1)
     {
         this->handlerError(QSerialPort::WriteError);
+        return;
     }
+    emit serialPortDataSent(data);
 }
 
 void SerialPortManager::handlerError(QSerialPort::SerialPortError error)
@@ -40,6 +40,12 @@ bool TcpNetworkManager::isTimestampEnabled()
     return m_displayTimestamp;
 }
 
+bool TcpNetworkManager::isClientConnected() const
+{
+    return m_currentMode == Mode::Client && m_pClientSocket
+        && m_pClientSocket->state() == QAbstractSocket::ConnectedState;
+}
+
 void TcpNetworkManager::startClient(const QString& address, quint16 port)
 {
     if (m_currentMode != Mode::Idle)
@@ -156,6 +162,16 @@ void TcpNetworkManager::stopTimedSend()
     }
 }
 
+void TcpNetworkManager::handleWriteDataFromModbus(const QByteArray& data)
+{
+    if (this->isClientConnected()) m_pClientSocket->write(data);
+}
+
+void TcpNetworkManager::setUseModbusStatus(bool status)
+{
+    m_isUseModbus = status;
+}
+
 void TcpNetworkManager::onNewConnection()
 {
     while (m_pTcpServer->hasPendingConnections())
@@ -237,9 +253,13 @@ void TcpNetworkManager::onReadyRead()
     QTcpSocket* socket = qobject_cast<QTcpSocket*>(sender());
     if (socket && m_readBuffers.contains(socket))
     {
-        // 只负责将数据追加到缓冲区，不做任何其他事
-        QMutexLocker locker(&m_bufferMutex);
-        m_readBuffers[socket].append(socket->readAll());
+        const QByteArray readData = socket->readAll();
+        {
+            // 只负责将数据追加到缓冲区，不做任何其他事
+            QMutexLocker locker(&m_bufferMutex);
+            m_readBuffers[socket].append(readData);
+        }
+        if (m_isUseModbus && socket == m_pClientSocket) emit sendReadData2Modbus(readData);
     }
 }
 
@@ -259,6 +279,7 @@ void TcpNetworkManager::onReadBufferTimeout()
         DataPacket packet;
         packet.sourceInfo = QString("%1:%2").arg(it.key()->peerAddress().toString()).arg(it.key()->peerPort());
         packet.data = dataToProcess;
+        packet.timestamp = QDateTime::currentMSecsSinceEpoch() * 1000;
         PacketProcessor::getInstance()->enqueueData(packet);
     }
 }
@@ -36,9 +36,29 @@ void AddEditModbusTagDialog::onDataTypeChanged(int index)
     m_pByteOrderComboBox->setEnabled(isMultiByte);
 }
 
+void AddEditModbusTagDialog::onFunctionCodeChanged(int index)
+{
+    int functionCode = m_pFunctionCodeComboBox->itemData(index).toInt();
+    int addressBase = ModbusUtils::addressBase(functionCode);
+    // 地址仍停留在其他数据区时，按相同偏移换算到当前数据区
+    int address = m_pAddressSpinBox->value();
+    if (address < addressBase || address > addressBase + 9998)
+    {
+        int offset = address % 10000;
+        m_pAddressSpinBox->setValue(addressBase + qMax(0, offset - 1));
+    }
+    // 线圈和离散输入只有0/1，数据类型、字节序和换算参数都不适用
+    bool isBit = ModbusUtils::isBitFunction(functionCode);
+    m_pDataTypeComboBox->setEnabled(!isBit);
+    m_pGainSpinBox->setEnabled(!isBit);
+    m_pOffsetSpinBox->setEnabled(!isBit);
+    if (isBit) m_pByteOrderComboBox->setEnabled(false);
+    else this->onDataTypeChanged(m_pDataTypeComboBox->currentIndex());
+}
+
 void AddEditModbusTagDialog::setUI()
 {
-    this->setMinimumSize(350, 364);
+    this->setMinimumSize(350, 456);
     this->createComponents();
     this->createLayout();
     this->connectSignals();
@@ -53,6 +73,8 @@ void AddEditModbusTagDialog::createComponents()
     m_pSlaveIdSpinBox = new QSpinBox(this);
     m_pSlaveIdSpinBox->setRange(1, 247);
     m_pFunctionCodeComboBox = new QComboBox(this);
+    m_pFunctionCodeComboBox->addItem("01: 读线圈", 1);
+    m_pFunctionCodeComboBox->addItem("02: 读离散输入", 2);
     m_pFunctionCodeComboBox->addItem("03: 读保持寄存器", 3);
     m_pFunctionCodeComboBox->addItem("04: 读输入寄存器", 4);
     m_pAddressSpinBox = new QSpinBox(this);
@@ -78,6 +100,21 @@ void AddEditModbusTagDialog::createComponents()
     m_pOffsetSpinBox->setDecimals(4);
     m_pOffsetSpinBox->setRange(-1000000, 1000000);
 
+    m_pScanIntervalSpinBox = new QSpinBox(this);
+    m_pScanIntervalSpinBox->setRange(0, 60000);
+    m_pScanIntervalSpinBox->setSingleStep(10);
+    m_pScanIntervalSpinBox->setSuffix(" ms");
+    m_pScanIntervalSpinBox->setSpecialValueText("跟随轮询间隔");
+    m_pScanPriorityComboBox = new QComboBox(this);
+    m_pScanPriorityComboBox->addItem("低", 0);
+    m_pScanPriorityComboBox->addItem("中", 1);
+    m_pScanPriorityComboBox->addItem("高", 2);
+    m_pChannelComboBox = new QComboBox(this);
+    m_pChannelComboBox->addItem("不绑定", QString());
+    for (const ChannelInfo& channel : ChannelManager::getInstance()->getAllChannels())
+        m_pChannelComboBox->addItem(QString("%1 (%2)").arg(channel.name, channel.id), channel.id);
+    m_pChannelComboBox->setToolTip("轮询读到的工程值按响应时间送入该波形通道，仅在开始录波后生效");
+
     m_pSaveButton = new QPushButton("保存", this);
     m_pCancelButton = new QPushButton("取消", this);
 }
@@ -95,6 +132,9 @@ void AddEditModbusTagDialog::createLayout()
     m_pFormLayout->addRow("字节序:", m_pByteOrderComboBox);
     m_pFormLayout->addRow("乘法系数 (Gain):", m_pGainSpinBox);
     m_pFormLayout->addRow("加法偏移 (Offset):", m_pOffsetSpinBox);
+    m_pFormLayout->addRow("扫描周期:", m_pScanIntervalSpinBox);
+    m_pFormLayout->addRow("扫描优先级:", m_pScanPriorityComboBox);
+    m_pFormLayout->addRow("波形通道:", m_pChannelComboBox);
 
     auto buttonBox = new QDialogButtonBox();
     buttonBox->addButton(m_pSaveButton, QDialogButtonBox::AcceptRole);
@@ -110,6 +150,8 @@ void AddEditModbusTagDialog::connectSignals()
     this->connect(m_pCancelButton, &QPushButton::clicked, this, &AddEditModbusTagDialog::reject);
     this->connect(m_pDataTypeComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this,
                   &AddEditModbusTagDialog::onDataTypeChanged);
+    this->connect(m_pFunctionCodeComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this,
+                  &AddEditModbusTagDialog::onFunctionCodeChanged);
 }
 
 void AddEditModbusTagDialog::loadTagData()
@@ -122,9 +164,15 @@ void AddEditModbusTagDialog::loadTagData()
     m_pByteOrderComboBox->setCurrentIndex(m_pByteOrderComboBox->findData(QVariant::fromValue(m_tag.byteOrder)));
     m_pGainSpinBox->setValue(m_tag.gain);
     m_pOffsetSpinBox->setValue(m_tag.offset);
-
-    // 初始状态下触发一次，以正确设置字节序控件的可用性
-    this->onDataTypeChanged(m_pDataTypeComboBox->currentIndex());
+    m_pScanIntervalSpinBox->setValue(m_tag.scanInterval);
+    m_pScanPriorityComboBox->setCurrentIndex(m_pScanPriorityComboBox->findData(m_tag.scanPriority));
+    // 绑定的通道已被删除时保留原标识，避免打开编辑后误解除绑定
+    if (!m_tag.channelId.isEmpty() && m_pChannelComboBox->findData(m_tag.channelId) < 0)
+        m_pChannelComboBox->addItem(QString("%1 (通道不存在)").arg(m_tag.channelId), m_tag.channelId);
+    m_pChannelComboBox->setCurrentIndex(m_pChannelComboBox->findData(m_tag.channelId));
+
+    // 初始状态下触发一次，以正确设置数据类型和字节序控件的可用性
+    this->onFunctionCodeChanged(m_pFunctionCodeComboBox->currentIndex());
 }
 
 void AddEditModbusTagDialog::saveTagData()
@@ -137,4 +185,7 @@ void AddEditModbusTagDialog::saveTagData()
     m_tag.byteOrder = m_pByteOrderComboBox->currentData().value<ModbusTag::ByteOrder>();
     m_tag.gain = m_pGainSpinBox->value();
     m_tag.offset = m_pOffsetSpinBox->value();
+    m_tag.scanInterval = m_pScanIntervalSpinBox->value();
+    m_tag.scanPriority = m_pScanPriorityComboBox->currentData().toInt();
+    m_tag.channelId = m_pChannelComboBox->currentData().toString();
 }
@@ -21,26 +21,59 @@ void ModbusDisplayWidget::onReadButtonClicked()
 {
     // 从UI获取参数
     int slaveId = m_pReadSlaveIdSpinBox->value();
+    int functionCode = m_pReadFuncCodeComboBox->currentData().toInt();
     // 从QComboBox获取用户输入的地址文本并转为整数，例如 "40001" -> 40001
     int startAddress = m_pReadAddrComboBox->currentText().toInt();
     int quantity = m_pReadQtySpinBox->value();
-    // 我们约定，保持寄存器的地址必须从40001开始
-    if (startAddress < 40001)
+    // 我们约定，点位地址按数据区编号：线圈00001、离散输入10001、输入寄存器30001、保持寄存器40001
+    int addressBase = ModbusUtils::addressBase(functionCode);
+    if (startAddress < addressBase || startAddress > addressBase + 65535)
     {
         // 在日志中给出清晰的错误提示
-        m_pLogTextEdit->appendPlainText("错误: 读取地址无效，保持寄存器地址应从40001开始。");
+        m_pLogTextEdit->appendPlainText(QString("错误: 读取地址无效，%1地址应从%2开始。")
+                                        .arg(m_pReadFuncCodeComboBox->currentText().mid(4))
+                                        .arg(addressBase, 5, 10, QChar('0')));
         return; // 中断操作
     }
     // Modbus协议帧中的地址是从0开始的，所以需要减去偏移量
-    int startAddressProtocol = startAddress - 40001; // 例如: 40001 -> 0, 40002 -> 1
+    int startAddressProtocol = startAddress - addressBase; // 例如: 40001 -> 0, 40002 -> 1
     // 将转换后的【协议地址】传递给控制器
-    m_pModbusController->readHoldingRegister(slaveId, startAddressProtocol, quantity);
+    int requestId = m_pModbusController->read(slaveId, functionCode, startAddressProtocol, quantity);
+    if (requestId >= 0) m_manualRequestIds.insert(requestId);
     // 日志中仍然显示用户输入的UI地址，这样更直观
-    QString logMsg = QString("发送读取请求 -> 从站: %1, 地址: %2, 数量: %3")
-                     .arg(slaveId).arg(startAddress).arg(quantity);
+    QString logMsg = QString("发送读取请求 -> 从站: %1, 功能码: 0x%2, 地址: %3, 数量: %4")
+                     .arg(slaveId).arg(functionCode, 2, 16, QChar('0')).arg(startAddress).arg(quantity);
     m_pLogTextEdit->appendPlainText(logMsg);
 }
 
+void ModbusDisplayWidget::onReadFuncCodeChanged(int index)
+{
+    int functionCode = m_pReadFuncCodeComboBox->itemData(index).toInt();
+    int addressBase = ModbusUtils::addressBase(functionCode);
+    m_pReadQtySpinBox->setRange(1, ModbusUtils::maxReadQuantity(functionCode));
+    m_pReadAddrComboBox->clear();
+    m_pReadAddrComboBox->addItems({QString("%1").arg(addressBase, 5, 10, QChar('0')),
+                                   QString("%1").arg(addressBase + 1, 5, 10, QChar('0'))});
+}
+
+void ModbusDisplayWidget::onWriteFuncCodeChanged(int index)
+{
+    int functionCode = m_pWriteFuncCodeComboBox->itemData(index).toInt();
+    bool isCoil = ModbusUtils::isBitFunction(functionCode);
+    int addressBase = ModbusUtils::addressBase(functionCode);
+    // 线圈只有开关量，不需要数据类型和字节序
+    m_pWriteDataTypeComboBox->setEnabled(!isCoil);
+    m_pWriteByteOrderComboBox->setEnabled(!isCoil);
+    m_pWriteValueLineEdit->setPlaceholderText(functionCode == 0x0F ? "1,0,1..." : isCoil ? "1/0" : QString());
+    int currentAddress = m_pWriteAddrComboBox->currentText().toInt();
+    if (currentAddress < addressBase || currentAddress > addressBase + 9998)
+    {
+        m_pWriteAddrComboBox->clear();
+        m_pWriteAddrComboBox->addItems({QString("%1").arg(addressBase, 5, 10, QChar('0')),
+                                        QString("%1").arg(addressBase + 1, 5, 10, QChar('0'))});
+    }
+}
+
 void ModbusDisplayWidget::onWriteButtonClicked()
 {
     // 获取UI参数
@@ -49,12 +82,41 @@ void ModbusDisplayWidget::onWriteButtonClicked()
     QString valueStr = m_pWriteValueLineEdit->text();
     // 获取功能码
     int functionCode = m_pWriteFuncCodeComboBox->currentData().toInt();
-    if (startAddress < 40001)
+    int addressBase = ModbusUtils::addressBase(functionCode);
+    if (startAddress < addressBase || startAddress > addressBase + 65535)
+    {
+        m_pLogTextEdit->appendPlainText(QString("错误: 写入地址无效，%1地址应从%2开始。")
+                                        .arg(ModbusUtils::isBitFunction(functionCode) ? "线圈" : "保持寄存器")
+                                        .arg(addressBase, 5, 10, QChar('0')));
+        return;
+    }
+    int addressProtocol = startAddress - addressBase; // 转换为协议地址
+    if (ModbusUtils::isBitFunction(functionCode))
     {
-        m_pLogTextEdit->appendPlainText("错误: 写入地址无效，保持寄存器地址应从40001开始。");
+        // 线圈按开关量解析，多个线圈以逗号或空格分隔
+        QList<bool> coilValues;
+        for (const QString& item : valueStr.split(QRegularExpression("[,\\s]+"), Qt::SkipEmptyParts))
+        {
+            const QString text = item.toLower();
+            if (text == "1" || text == "on" || text == "true") coilValues.append(true);
+            else if (text == "0" || text == "off" || text == "false") coilValues.append(false);
+            else
+            {
+                m_pLogTextEdit->appendPlainText("错误: 无效的线圈值。请输入1/0或on/off。");
+                return;
+            }
+        }
+        if (coilValues.isEmpty() || (functionCode == 0x05 && coilValues.size() != 1) || coilValues.size() > 1968)
+        {
+            m_pLogTextEdit->appendPlainText("错误: 05功能码只能写入一个线圈，0F功能码最多写入1968个线圈。");
+            return;
+        }
+        if (functionCode == 0x05) m_pModbusController->writeSingleCoil(slaveId, addressProtocol, coilValues.first());
+        else m_pModbusController->writeMultipleCoils(slaveId, addressProtocol, coilValues);
+        m_pLogTextEdit->appendPlainText(QString("发送写线圈请求 -> 从站:%1, 地址:%2, 数量:%3")
+                                        .arg(slaveId).arg(startAddress).arg(coilValues.size()));
         return;
     }
-    int addressProtocol = startAddress - 40001; // 转换为协议地址
     // 根据数据类型，将输入的字符串转换为待发送的寄存器值列表
     bool ok = false;
     QList<quint16> valuesToSend; // 待发送的寄存器值列表
@@ -72,10 +134,10 @@ void ModbusDisplayWidget::onWriteButtonClicked()
     }
     else // 假设其他索引是32位数据类型 (Float, UInt32, etc.)
     {
-        // 32位数据必须使用0x10功能码
-        if (functionCode != 0x10)
+        // 32位数据必须使用0x10或0x17功能码
+        if (functionCode != 0x10 && functionCode != 0x17)
         {
-            m_pLogTextEdit->appendPlainText("错误: 写入32位数据类型时，功能码必须选择'10: 写多个寄存器'。");
+            m_pLogTextEdit->appendPlainText("错误: 写入32位数据类型时，功能码必须选择'10: 写多个寄存器'或'17: 读写多个寄存器'。");
             return;
         }
         quint32 rwa32Val = 0;
@@ -140,6 +202,15 @@ void ModbusDisplayWidget::onWriteButtonClicked()
         m_pLogTextEdit->appendPlainText(QString("发送写多个寄存器请求 -> 从站:%1, 地址:%2, 数量:%3")
                                         .arg(slaveId).arg(startAddress).arg(valuesToSend.size()));
     }
+    else if (functionCode == 0x17)
+    {
+        // 写入设定值后立即回读同一段寄存器，一次往返完成
+        int requestId = m_pModbusController->readWriteMultipleRegisters(slaveId, addressProtocol, valuesToSend.size(),
+                                                                        addressProtocol, valuesToSend);
+        if (requestId >= 0) m_manualRequestIds.insert(requestId);
+        m_pLogTextEdit->appendPlainText(QString("发送读写多个寄存器请求 -> 从站:%1, 地址:%2, 数量:%3")
+                                        .arg(slaveId).arg(startAddress).arg(valuesToSend.size()));
+    }
 }
 
 void ModbusDisplayWidget::onPollButtonToggled(bool checked)
@@ -147,14 +218,14 @@ void ModbusDisplayWidget::onPollButtonToggled(bool checked)
     if (checked)
     {
         // 生成请求列表
-        this->generateReadRequests();
+        this->generateScanGroups();
         if (m_modbusTags.isEmpty())
         {
             m_pLogTextEdit->appendPlainText("提示: 没有配置点位。请先配置点位。");
             m_pPollButton->setChecked(false);
             return;
         }
-        if (m_readRequests.isEmpty())
+        if (m_scanGroups.isEmpty())
         {
             m_pLogTextEdit->appendPlainText("提示: 未生成有效的读取请求，请先配置点位。");
             m_pPollButton->setChecked(false);
@@ -162,103 +233,194 @@ void ModbusDisplayWidget::onPollButtonToggled(bool checked)
         }
         m_isPolling = true;
         m_pPollButton->setText("停止轮询");
-        m_pOperationsGroupBox->setEnabled(false);
-        m_pConfigTagsButton->setEnabled(false);
-        // 启动定时器
-        int interval = m_pPollIntervalSpinBox->value();
-        m_pPollTimer->start(interval);
-        this->onPollTimerTimeout();
+        this->setBusControlsEnabled(false);
+        // 请求完成后立即发出下一个到期的请求
+        m_pPollScheduler->setScanGroups(m_scanGroups);
+        m_pPollScheduler->start();
     }
     else
     {
-        m_isPolling = false;
-        m_pPollTimer->stop();
-        m_pPollButton->setText("开始轮询");
-        m_pOperationsGroupBox->setEnabled(true);
-        m_pConfigTagsButton->setEnabled(true);
-        m_currentRequestIndex = 0; // 重置索引
+        this->stopPolling();
     }
 }
 
-void ModbusDisplayWidget::onPollTimerTimeout()
+void ModbusDisplayWidget::onSnifferButtonToggled(bool checked)
 {
-    if (!m_isPolling || m_readRequests.isEmpty())
+    if (checked)
     {
-        m_pPollTimer->stop();
-        return;
+        // 点位表在监听期间不可编辑，按(从站, 数据区)预先分好点位
+        m_snifferTagIndex.clear();
+        for (int i = 0; i < m_modbusTags.size(); ++i)
+        {
+            const ModbusTag& tag = m_modbusTags[i];
+            m_snifferTagIndex[(tag.slaveId << 8) | tag.functionCode].append(i);
+        }
+        // 控制器不再解析串口数据，也不会发出请求
+        m_pModbusController->setPassive(true);
+        m_pSniffer->start();
+        m_pSnifferButton->setText("停止监听");
+        this->setBusControlsEnabled(false);
+        m_pLogTextEdit->appendPlainText("开始监听总线: 解析其他主站的请求和从站响应，不发送任何数据");
+    }
+    else
+    {
+        m_pSniffer->stop();
+        m_pModbusController->setPassive(false);
+        m_snifferTagIndex.clear();
+        m_pSnifferButton->setText("总线监听");
+        this->setBusControlsEnabled(true);
+        m_pLogTextEdit->appendPlainText(QString("停止监听总线: 共识别 %1 帧，丢弃无法识别的数据 %2 字节")
+                                        .arg(m_pSniffer->getFrameCount()).arg(m_pSniffer->getDiscardedBytes()));
     }
-    // 获取当前请求
-    const ModbusReadRequest& request = m_readRequests[m_currentRequestIndex];
-    // 调用Controller发送指令
-    m_pModbusController->readHoldingRegister(request.slaveId, request.startAddress, request.quantity);
-    // 循环发送
-    m_currentRequestIndex = (m_currentRequestIndex + 1) % m_readRequests.size();
+}
+
+void ModbusDisplayWidget::onTransportChanged(int index)
+{
+    auto transport = m_pTransportComboBox->itemData(index).value<ModbusController::Transport>();
+    const bool isTcp = transport == ModbusController::Transport::Tcp;
+    m_pModbusController->setTransport(transport);
+    m_pRequestPlanner->reset(); // 换了链路，之前测得的延迟不再适用
+    // 只有TCP客户端的数据需要额外转发给Modbus控制器
+    TcpNetworkManager::getInstance()->setUseModbusStatus(isTcp);
+    m_pMaxInFlightLabel->setEnabled(isTcp);
+    m_pMaxInFlightSpinBox->setEnabled(isTcp);
+    // 监听只解析串口上的RTU帧
+    m_pSnifferButton->setEnabled(!isTcp);
+}
+
+void ModbusDisplayWidget::onPlanInvalidated()
+{
+    if (!m_isPolling) return;
+    // 轮询中直接替换请求集，下一次分发即使用新的请求
+    this->generateScanGroups();
+    if (!m_scanGroups.isEmpty()) m_pPollScheduler->setScanGroups(m_scanGroups);
+}
+
+void ModbusDisplayWidget::onScanStatisticsUpdated(const QList<ModbusScanGroupStatistics>& statistics)
+{
+    static const QStringList priorityNames = {"低", "中", "高"};
+    QStringList items;
+    for (const ModbusScanGroupStatistics& item : statistics)
+    {
+        const QString priorityName = priorityNames.value(item.priority, QString::number(item.priority));
+        items.append(QString("%1ms/%2: %3次/s").arg(item.interval).arg(priorityName)
+                                               .arg(item.achievedRate, 0, 'f', 1));
+    }
+    m_pScanRateLabel->setText(items.join("  "));
+    // 提示中附上各从站的响应延迟分位数和超时情况
+    QStringList tips = {"各扫描组(扫描周期/优先级)实际每秒完成的扫描次数"};
+    const QList<ModbusSlaveLinkStatistics> slaveStatistics = m_pModbusController->getSlaveStatistics();
+    for (const ModbusSlaveLinkStatistics& item : slaveStatistics)
+    {
+        tips.append(QString("从站%1%2: 响应延迟p50 %3ms p99 %4ms, 超时余量 %5ms, 超时%6次, 重试%7次")
+                    .arg(item.slaveId).arg(item.isOnline ? "" : "(离线)")
+                    .arg(item.p50, 0, 'f', 1).arg(item.p99, 0, 'f', 1).arg(item.timeoutMargin)
+                    .arg(item.timeoutCount).arg(item.retryCount));
+    }
+    m_pScanRateLabel->setToolTip(tips.join("\n"));
+}
+
+void ModbusDisplayWidget::onSlaveStatusChanged(int slaveId, bool online)
+{
+    const QString message = online
+                                ? QString("从站 %1 恢复响应，恢复正常扫描").arg(slaveId)
+                                : QString("从站 %1 连续无响应，降为每 %2 秒探测一次")
+                                  .arg(slaveId).arg(ModbusPollScheduler::PROBE_INTERVAL / 1000);
+    m_pLogTextEdit->appendPlainText(message);
+    CMessageBox::showToast(this, message);
 }
 
 void ModbusDisplayWidget::onConfigTagsButtonClicked()
 {
     TagManagerDialog dialog(m_modbusTags, this);
-    if (dialog.exec() == QDialog::Accepted)
+    dialog.exec();
+    // 对话框直接修改点位表(包括导入)，无论如何关闭都要刷新表格
+    m_pTagModel->layoutRefresh();
+    // 立即重新规划读请求，日志中马上能看到新点位表的请求数和预计扫描时间
+    this->generateScanGroups();
+}
+
+void ModbusDisplayWidget::onSimulatorButtonClicked()
+{
+    if (!m_pSimulatorDialog) m_pSimulatorDialog = new ModbusSimulatorDialog(this);
+    m_pSimulatorDialog->show();
+    m_pSimulatorDialog->raise();
+    m_pSimulatorDialog->activateWindow();
+}
+
+void ModbusDisplayWidget::onClearLogButtonClicked()
+{
+    m_pLogTextEdit->clear();
+    m_pTransactionLogModel->clear();
+    m_lastRequestCount = 0;
+    this->onCounterTimeout();
+}
+
+void ModbusDisplayWidget::onCounterTimeout()
+{
+    const ModbusTransactionLog& log = m_pTransactionLogModel->getLog();
+    const ModbusTransactionCounters total = log.getTotalCounters();
+    const double requestRate = (total.requestCount - m_lastRequestCount) * 1000.0 / COUNTER_INTERVAL;
+    m_lastRequestCount = total.requestCount;
+    m_pTransactionCounterLabel->setText(QString("请求 %1次/s  累计 %2  超时 %3  CRC错误 %4  异常 %5  响应无效 %6")
+                                        .arg(requestRate, 0, 'f', 1).arg(total.requestCount)
+                                        .arg(total.timeoutCount).arg(total.crcErrorCount)
+                                        .arg(total.exceptionCount).arg(total.invalidResponseCount));
+    // 提示中按从站列出计数
+    QStringList tips = {QString("最近 %1 条记录，最多保留 %2 条").arg(log.size()).arg(log.capacity())};
+    for (int slaveId : log.getSlaveIds())
     {
-        m_pTagModel->layoutRefresh();
+        const ModbusTransactionCounters counters = log.getCounters(slaveId);
+        tips.append(QString("从站%1: 请求%2, 成功%3, 超时%4, CRC错误%5, 异常%6, 响应无效%7")
+                    .arg(slaveId).arg(counters.requestCount).arg(counters.successCount)
+                    .arg(counters.timeoutCount).arg(counters.crcErrorCount)
+                    .arg(counters.exceptionCount).arg(counters.invalidResponseCount));
     }
+    m_pTransactionCounterLabel->setToolTip(tips.join("\n"));
 }
 
-void ModbusDisplayWidget::onClearLogButtonClicked() { m_pLogTextEdit->clear(); }
-
-void ModbusDisplayWidget::onModbusDataReady(int startAddress, const QList<quint16>& values)
+void ModbusDisplayWidget::onModbusDataReady(int requestId, int functionCode, int startAddress,
+                                            const QList<quint16>& values)
 {
-    // 正确的逻辑：遍历我们关心的“点位列表”，而不是“返回的值列表”
+    // 轮询请求由onScanResponseReady按预编译的解码步骤处理，这里只处理手动读取和0x17回读
+    if (!m_manualRequestIds.remove(requestId)) return;
+    // 遍历我们关心的“点位列表”，找出落在本次返回数据范围内的点位
     for (int i = 0; i < m_modbusTags.size(); ++i)
     {
-        ModbusTag& tag = m_modbusTags[i];
-        // 跳过非读取操作
-        if (tag.functionCode != 3) continue;
-        // 步骤1: 将点位的UI地址(如40001)转换为协议地址(如0)
-        int tagProtocolAddress = tag.address - 40001;
-        // 步骤2: 判断该点位的协议地址，是否在本次返回的数据帧范围内
-        // 例如，请求从地址0开始读10个，那么范围就是[0, 9]。我们要判断tagProtocolAddress是否在这个区间内。
-        if (tagProtocolAddress >= startAddress && tagProtocolAddress < (startAddress + values.size()))
-        {
-            // 步骤3: 计算该点位在 `values` 列表中的准确索引
-            int valueIndex = tagProtocolAddress - startAddress;
-            // 步骤4: 根据点位的数据类型进行处理
-            if (tag.dataType == ModbusTag::DataType::Float32
-                || tag.dataType == ModbusTag::DataType::Int32
-                || tag.dataType == ModbusTag::DataType::UInt32)
-            {
-                // 对于32位数据，需要确保有两个寄存器的空间
-                if (valueIndex + 1 < values.size())
-                {
-                    quint16 reg1 = values[valueIndex]; // 低地址寄存器
-                    quint16 reg2 = values[valueIndex + 1]; // 高地址寄存器
-                    // 重新组合和解释数据
-                    quint32 rawValue = ModbusUtils::reassemble32BitValue(reg1, reg2, tag.byteOrder);
-                    QVariant finalVariant = ModbusUtils::interpretRaw32BitValue(rawValue, tag.dataType);
-                    if (finalVariant.isValid())
-                    {
-                        double finalValue = finalVariant.toDouble();
-                        tag.currentValue = finalValue * tag.gain + tag.offset; // 应用增益和偏移
-                    }
-                    // 记录原始值用于显示
-                    tag.rawValue = QString("0x%1 0x%2")
-                                   .arg(reg1, 4, 16, QChar('0')).toUpper()
-                                   .arg(reg2, 4, 16, QChar('0')).toUpper();
-                    m_pTagModel->valueUpdate(i); // 通知UI更新
-                }
-            }
-            else if (tag.dataType == ModbusTag::DataType::UInt16 || tag.dataType == ModbusTag::DataType::Int16)
-            {
-                // 对于16位数据，直接取值
-                quint16 rawValue = values[valueIndex];
-                tag.rawValue = rawValue;
-                tag.currentValue = static_cast<double>(rawValue) * tag.gain + tag.offset; // 应用增益和偏移
-                m_pTagModel->valueUpdate(i); // 通知UI更新
-            }
-        }
+        const ModbusTag& tag = m_modbusTags[i];
+        // 只处理与本次响应同一数据区的点位
+        if (tag.functionCode != functionCode) continue;
+        // 将点位的UI地址(如40001)转换为协议地址(如0)，再换算为在 `values` 列表中的索引
+        int valueIndex = tag.address - ModbusUtils::addressBase(tag.functionCode) - startAddress;
+        if (valueIndex < 0 || valueIndex >= values.size()) continue;
+        this->applyDecodeEntry(ModbusUtils::compileDecodeEntry(tag, i, valueIndex), values);
     }
     // 在日志中显示成功信息
-    m_pLogTextEdit->appendPlainText(QString("成功接收并解析了 %1 个寄存器值。").arg(values.size()));
+    m_pLogTextEdit->appendPlainText(QString("成功接收并解析了 %1 个%2值。").arg(values.size())
+                                    .arg(ModbusUtils::isBitFunction(functionCode) ? "位" : "寄存器"));
+}
+
+void ModbusDisplayWidget::onScanResponseReady(const ModbusReadRequest& request, const QList<quint16>& values)
+{
+    // 只遍历本请求覆盖的点位，地址换算和类型判断都已在生成请求时完成
+    this->applyDecodePlan(request.decodePlan, values);
+}
+
+void ModbusDisplayWidget::onSniffedValuesObserved(int slaveId, int functionCode, int startAddress,
+                                                  const QList<quint16>& values)
+{
+    const auto it = m_snifferTagIndex.constFind((slaveId << 8) | functionCode);
+    if (it == m_snifferTagIndex.cend()) return;
+    // 监听到的请求不是按点位表生成的，按地址现场找出落在本次数据范围内的点位
+    QList<ModbusDecodeEntry> plan;
+    for (int tagIndex : *it)
+    {
+        const ModbusTag& tag = m_modbusTags[tagIndex];
+        const int offset = tag.address - ModbusUtils::addressBase(tag.functionCode) - startAddress;
+        if (offset < 0 || offset + ModbusUtils::registerCount(tag) > values.size()) continue;
+        plan.append(ModbusUtils::compileDecodeEntry(tag, tagIndex, offset));
+    }
+    if (!plan.isEmpty()) this->applyDecodePlan(plan, values);
 }
 
 void ModbusDisplayWidget::onWriteSuccessful(int functionCode, int address)
@@ -268,16 +430,43 @@ void ModbusDisplayWidget::onWriteSuccessful(int functionCode, int address)
     m_pLogTextEdit->appendPlainText(logMsg);
 }
 
+void ModbusDisplayWidget::applyDecodePlan(const QList<ModbusDecodeEntry>& plan, const QList<quint16>& values)
+{
+    // 响应解析后同步到达这里，此刻即响应时间，同一响应中的点位共用一个时间戳
+    ChannelManager* chManager = ChannelManager::getInstance();
+    const bool isRecording = chManager->isDataRecordingEnabled();
+    if (isRecording && !m_waveformClock.isValid()) m_waveformClock.start();
+    const double timestamp = isRecording ? m_waveformClock.nsecsElapsed() / 1e6 : 0.0;
+    QHash<QString, QString> idToNameMap;
+    QHash<QString, QVector<double>> waveformValues; // 通道名 -> 本次响应的采样值
+    for (const ModbusDecodeEntry& entry : plan)
+    {
+        if (!this->applyDecodeEntry(entry, values) || !isRecording) continue;
+        const ModbusTag& tag = m_modbusTags[entry.tagIndex];
+        if (tag.channelId.isEmpty()) continue;
+        auto it = idToNameMap.find(tag.channelId);
+        if (it == idToNameMap.end()) it = idToNameMap.insert(tag.channelId, chManager->getChannel(tag.channelId).name);
+        if (it->isEmpty()) continue; // 通道已被删除
+        waveformValues[*it].append(tag.currentValue.toDouble());
+    }
+    // 每个通道每次响应只发送一个数据块
+    for (auto it = waveformValues.cbegin(); it != waveformValues.cend(); ++it)
+        PacketProcessor::getInstance()->publishWaveformBlock(it.key(), QVector<double>(it->size(), timestamp), *it);
+}
+
 void ModbusDisplayWidget::setUI()
 {
     // 初始化modbus控制器
     m_pModbusController = new ModbusController(SerialPortManager::getInstance(), this);
+    m_pTransactionLogModel = new ModbusTransactionLogModel(this);
     this->setAttribute(Qt::WA_StyledBackground);
     this->createComponents();
     this->createLayout();
     this->connectSignals();
     m_pTagModel = new ModbusTagModel(&m_modbusTags, this);
     m_pDisplayTableView->setModel(m_pTagModel);
+    m_pTransactionTableView->setModel(m_pTransactionLogModel);
+    this->onCounterTimeout();
 }
 
 void ModbusDisplayWidget::createComponents()
@@ -295,6 +484,13 @@ void ModbusDisplayWidget::createComponents()
     m_pReadSlaveIdSpinBox->setRange(1, 247);
     m_pReadSlaveIdSpinBox->setFixedWidth(60);
     m_pReadSlaveIdSpinBox->setFocusPolicy(Qt::StrongFocus);
+    m_pReadFuncCodeLabel = new QLabel("功能码:");
+    m_pReadFuncCodeComboBox = new QComboBox(this);
+    m_pReadFuncCodeComboBox->addItem("01: 读线圈", 0x01);
+    m_pReadFuncCodeComboBox->addItem("02: 读离散输入", 0x02);
+    m_pReadFuncCodeComboBox->addItem("03: 读保持寄存器", 0x03);
+    m_pReadFuncCodeComboBox->addItem("04: 读输入寄存器", 0x04);
+    m_pReadFuncCodeComboBox->setCurrentIndex(2);
     m_pReadAddrLabel = new QLabel("起始:");
     m_pReadAddrComboBox = new QComboBox(this);
     m_pReadAddrComboBox->setEditable(true);
@@ -326,8 +522,12 @@ void ModbusDisplayWidget::createComponents()
     m_pWriteValueLineEdit = new QLineEdit(this);
     m_pWriteFuncCodeLabel = new QLabel("功能码:");
     m_pWriteFuncCodeComboBox = new QComboBox(this);
+    m_pWriteFuncCodeComboBox->addItem("05: 写单个线圈", 0x05);
+    m_pWriteFuncCodeComboBox->addItem("0F: 写多个线圈", 0x0F);
     m_pWriteFuncCodeComboBox->addItem("06: 写单个寄存器", 0x06);
     m_pWriteFuncCodeComboBox->addItem("10: 写多个寄存器", 0x10);
+    m_pWriteFuncCodeComboBox->addItem("17: 读写多个寄存器", 0x17);
+    m_pWriteFuncCodeComboBox->setCurrentIndex(2);
     m_pWriteDataTypeLabel = new QLabel("类型:");
     m_pWriteDataTypeComboBox = new QComboBox(this);
     m_pWriteDataTypeComboBox->addItem("16位整数"); // 示例
@@ -347,6 +547,29 @@ void ModbusDisplayWidget::createComponents()
     m_pPollButton = new QPushButton("开始轮询", this);
     m_pPollButton->setCheckable(true);
     m_pPollButton->setObjectName("pollButton");
+    m_pSnifferButton = new QPushButton("总线监听", this);
+    m_pSnifferButton->setCheckable(true);
+    m_pSnifferButton->setToolTip("只接收不发送，解析总线上其他主站的请求和从站响应并更新点位表");
+    m_pTransportLabel = new QLabel("传输:");
+    m_pTransportComboBox = new QComboBox(this);
+    m_pTransportComboBox->addItem("RTU (串口)", QVariant::fromValue(ModbusController::Transport::Rtu));
+    m_pTransportComboBox->addItem("TCP (网络客户端)", QVariant::fromValue(ModbusController::Transport::Tcp));
+    m_pMaxInFlightLabel = new QLabel("并发请求:");
+    m_pMaxInFlightLabel->setEnabled(false);
+    m_pMaxInFlightSpinBox = new QSpinBox(this);
+    m_pMaxInFlightSpinBox->setRange(1, 16);
+    m_pMaxInFlightSpinBox->setValue(m_pModbusController->getMaxInFlight());
+    m_pMaxInFlightSpinBox->setFixedWidth(60);
+    m_pMaxInFlightSpinBox->setFocusPolicy(Qt::StrongFocus);
+    m_pMaxInFlightSpinBox->setToolTip("Modbus TCP下同时在途的请求数，按MBAP事务号匹配响应");
+    m_pMaxInFlightSpinBox->setEnabled(false);
+    m_pRetryLabel = new QLabel("重试次数:");
+    m_pRetrySpinBox = new QSpinBox(this);
+    m_pRetrySpinBox->setRange(0, 5);
+    m_pRetrySpinBox->setValue(m_pModbusController->getMaxRetries());
+    m_pRetrySpinBox->setFixedWidth(60);
+    m_pRetrySpinBox->setFocusPolicy(Qt::StrongFocus);
+    m_pRetrySpinBox->setToolTip("请求超时后重发的次数；超时时间按帧长、波特率和实测响应延迟自动计算");
     m_pPollIntervalLabel = new QLabel("轮询间隔:");
     m_pPollIntervalSpinBox = new QSpinBox(this);
     m_pPollIntervalSpinBox->setRange(100, 60000);
@@ -354,18 +577,34 @@ void ModbusDisplayWidget::createComponents()
     m_pPollIntervalSpinBox->setSuffix(" ms");
     m_pPollIntervalSpinBox->setFixedWidth(90);
     m_pPollIntervalSpinBox->setFocusPolicy(Qt::StrongFocus);
+    m_pPollIntervalSpinBox->setToolTip("未单独设置扫描周期的点位使用该间隔");
+    m_pScanRateLabel = new QLabel(this);
     m_pConfigTagsButton = new QPushButton("配置点位表", this);
+    m_pSimulatorButton = new QPushButton("从站仿真", this);
+    m_pSimulatorButton->setToolTip("在本机启动一个Modbus从站，用于无设备时测试轮询");
 
     // --- 4. 创建"数据显示区"内的控件 ---
     m_pDisplayTableView = new QTableView(this);
     m_pDisplayTableView->horizontalHeader()->setStretchLastSection(true);
     QHeaderView* verticalHeader = m_pDisplayTableView->verticalHeader();
-    verticalHeader->setSectionResizeMode(QHeaderView::ResizeToContents);
+    // 行号宽度和行高与点位值无关，固定行高避免数千行点位每次刷新都重新测量所有行
+    verticalHeader->setSectionResizeMode(QHeaderView::Fixed);
 
     // --- 5. 创建"日志区"内的控件 ---
+    m_pLogTabWidget = new QTabWidget(this);
     m_pLogTextEdit = new QPlainTextEdit(this);
     m_pLogTextEdit->setReadOnly(true);
+    m_pLogTextEdit->setMaximumBlockCount(MAX_LOG_LINES); // 轮询出错时日志持续增长，只保留最近的部分
+    m_pTransactionCounterLabel = new QLabel(this);
+    m_pTransactionTableView = new QTableView(this);
+    m_pTransactionTableView->horizontalHeader()->setStretchLastSection(true);
+    // 记录可能有上万行，固定行高，不按内容测量
+    m_pTransactionTableView->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    m_pTransactionTableView->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_pTransactionTableView->setWordWrap(false);
     m_pClearLogButton = new QPushButton("清除日志", this);
+    m_pCounterTimer = new QTimer(this);
+    m_pCounterTimer->setInterval(COUNTER_INTERVAL);
 }
 
 void ModbusDisplayWidget::createLayout()
@@ -388,6 +627,8 @@ void ModbusDisplayWidget::createLayout()
     auto readLayout = new QHBoxLayout();
     readLayout->addWidget(m_pReadLabel);
     readLayout->addWidget(m_pReadSlaveIdSpinBox);
+    readLayout->addWidget(m_pReadFuncCodeLabel);
+    readLayout->addWidget(m_pReadFuncCodeComboBox);
     readLayout->addWidget(m_pReadAddrLabel);
     readLayout->addWidget(m_pReadAddrComboBox);
     readLayout->addWidget(m_pReadQtyLabel);
@@ -421,9 +662,18 @@ void ModbusDisplayWidget::createLayout()
     // --- 3. 填充"控制与配置区" GroupBox (重新设计布局) ---
     m_pControllerLayout = new QHBoxLayout(m_pControllerGroupBox);
     m_pControllerLayout->addWidget(m_pPollButton);
+    m_pControllerLayout->addWidget(m_pSnifferButton);
+    m_pControllerLayout->addWidget(m_pTransportLabel);
+    m_pControllerLayout->addWidget(m_pTransportComboBox);
+    m_pControllerLayout->addWidget(m_pMaxInFlightLabel);
+    m_pControllerLayout->addWidget(m_pMaxInFlightSpinBox);
+    m_pControllerLayout->addWidget(m_pRetryLabel);
+    m_pControllerLayout->addWidget(m_pRetrySpinBox);
     m_pControllerLayout->addWidget(m_pPollIntervalLabel);
     m_pControllerLayout->addWidget(m_pPollIntervalSpinBox);
+    m_pControllerLayout->addWidget(m_pScanRateLabel);
     m_pControllerLayout->addStretch(); // 弹性空间
+    m_pControllerLayout->addWidget(m_pSimulatorButton);
     m_pControllerLayout->addWidget(m_pConfigTagsButton);
 
 
@@ -434,37 +684,85 @@ void ModbusDisplayWidget::createLayout()
 
     // --- 5. 填充"日志区" GroupBox (保持不变) ---
     m_pLogLayout = new QVBoxLayout(m_pLogGroupBox);
-    m_pLogLayout->addWidget(m_pLogTextEdit);
+    auto transactionPage = new QWidget(this);
+    auto transactionLayout = new QVBoxLayout(transactionPage);
+    transactionLayout->setContentsMargins(0, 0, 0, 0);
+    transactionLayout->addWidget(m_pTransactionCounterLabel);
+    transactionLayout->addWidget(m_pTransactionTableView);
+    m_pLogTabWidget->addTab(m_pLogTextEdit, "消息");
+    m_pLogTabWidget->addTab(transactionPage, "事务记录");
+    m_pLogLayout->addWidget(m_pLogTabWidget);
     m_pLogLayout->addWidget(m_pClearLogButton, 0, Qt::AlignRight);
 }
 
 void ModbusDisplayWidget::connectSignals()
 {
-    m_pPollTimer = new QTimer(this);
-    // 连接定时器的timeout信号到我们新增的槽函数
-    this->connect(m_pPollTimer, &QTimer::timeout, this, &ModbusDisplayWidget::onPollTimerTimeout);
+    m_pPollScheduler = new ModbusPollScheduler(m_pModbusController, this);
+    m_pRequestPlanner = new ModbusRequestPlanner(m_pModbusController, this);
+    m_pSniffer = new ModbusRtuSniffer(SerialPortManager::getInstance(), this);
+    this->connect(m_pSniffer, &ModbusRtuSniffer::valuesObserved, this, &ModbusDisplayWidget::onSniffedValuesObserved);
+    this->connect(m_pSniffer, &ModbusRtuSniffer::transactionLogged, m_pTransactionLogModel,
+                  &ModbusTransactionLogModel::append);
+    this->connect(m_pRequestPlanner, &ModbusRequestPlanner::planInvalidated, this,
+                  &ModbusDisplayWidget::onPlanInvalidated);
+    this->connect(m_pPollScheduler, &ModbusPollScheduler::statisticsUpdated, this,
+                  &ModbusDisplayWidget::onScanStatisticsUpdated);
+    this->connect(m_pPollScheduler, &ModbusPollScheduler::responseReady, this,
+                  &ModbusDisplayWidget::onScanResponseReady);
     this->connect(m_pReadButton, &QPushButton::clicked, this, &ModbusDisplayWidget::onReadButtonClicked);
     this->connect(m_pWriteButton, &QPushButton::clicked, this, &ModbusDisplayWidget::onWriteButtonClicked);
     this->connect(m_pPollButton, &QPushButton::toggled, this, &ModbusDisplayWidget::onPollButtonToggled);
+    this->connect(m_pSnifferButton, &QPushButton::toggled, this, &ModbusDisplayWidget::onSnifferButtonToggled);
+    this->connect(m_pTransportComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this,
+                  &ModbusDisplayWidget::onTransportChanged);
+    this->connect(m_pMaxInFlightSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), m_pModbusController,
+                  &ModbusController::setMaxInFlight);
+    this->connect(m_pRetrySpinBox, QOverload<int>::of(&QSpinBox::valueChanged), m_pModbusController,
+                  &ModbusController::setMaxRetries);
+    this->connect(m_pModbusController, &ModbusController::slaveStatusChanged, this,
+                  &ModbusDisplayWidget::onSlaveStatusChanged);
     this->connect(m_pConfigTagsButton, &QPushButton::clicked, this, &ModbusDisplayWidget::onConfigTagsButtonClicked);
+    this->connect(m_pSimulatorButton, &QPushButton::clicked, this, &ModbusDisplayWidget::onSimulatorButtonClicked);
     this->connect(m_pClearLogButton, &QPushButton::clicked, this, &ModbusDisplayWidget::onClearLogButtonClicked);
+    this->connect(m_pModbusController, &ModbusController::transactionLogged, m_pTransactionLogModel,
+                  &ModbusTransactionLogModel::append);
+    this->connect(m_pCounterTimer, &QTimer::timeout, this, &ModbusDisplayWidget::onCounterTimeout);
+    m_pCounterTimer->start();
+    // 停在末尾时跟随新记录滚动，向上翻看历史记录时保持不动
+    this->connect(m_pTransactionLogModel, &QAbstractItemModel::rowsAboutToBeInserted, this, [this]
+    {
+        QScrollBar* scrollBar = m_pTransactionTableView->verticalScrollBar();
+        m_isTransactionLogAtBottom = scrollBar->value() == scrollBar->maximum();
+    });
+    this->connect(m_pTransactionLogModel, &QAbstractItemModel::rowsInserted, this, [this]
+    {
+        if (m_isTransactionLogAtBottom) m_pTransactionTableView->scrollToBottom();
+    });
     this->connect(m_pModbusController, &ModbusController::dataReady, this, &ModbusDisplayWidget::onModbusDataReady);
+    // 与串口波形的采样计数一同在清空波形数据时归零
+    this->connect(ChannelManager::getInstance(), &ChannelManager::channelsDataAllClearedRequested, this, [this]
+    {
+        m_waveformClock.invalidate();
+    });
     this->connect(m_pModbusController, &ModbusController::writeSuccessful, this,
                   &ModbusDisplayWidget::onWriteSuccessful);
     this->connect(m_pModbusController, &ModbusController::errorOccurred, [this](const QString& errorString)
     {
-        CMessageBox::showToast(this, errorString);
-        if (m_isPolling)
+        if (!m_isPolling)
         {
-            m_pPollButton->setChecked(false);
-            m_isPolling = false;
-            m_pPollTimer->stop();
-            m_pPollButton->setText("开始轮询");
-            m_pOperationsGroupBox->setEnabled(true);
-            m_pConfigTagsButton->setEnabled(true);
-            m_currentRequestIndex = 0; // 重置索引
+            CMessageBox::showToast(this, errorString);
+            return;
         }
+        // 轮询中的超时和异常由控制器重试、离线从站降级处理，逐条结果见事务记录；链路本身断开时才停止轮询
+        if (m_pModbusController->isTransportOpen()) return;
+        m_pLogTextEdit->appendPlainText(QString("错误: %1").arg(errorString));
+        CMessageBox::showToast(this, errorString);
+        m_pPollButton->setChecked(false); // 触发toggled停止轮询
     });
+    this->connect(m_pReadFuncCodeComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this,
+                  &ModbusDisplayWidget::onReadFuncCodeChanged);
+    this->connect(m_pWriteFuncCodeComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this,
+                  &ModbusDisplayWidget::onWriteFuncCodeChanged);
     this->connect(m_pWriteDataTypeComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), [this](int index)
     {
         if (index != 0)
@@ -480,53 +778,66 @@ void ModbusDisplayWidget::connectSignals()
     });
 }
 
-void ModbusDisplayWidget::generateReadRequests()
+void ModbusDisplayWidget::generateScanGroups()
 {
-    m_readRequests.clear();
+    m_scanGroups.clear();
     if (m_modbusTags.isEmpty()) return;
-    // 为了能正确合并，先按从站ID和地址对点位列表进行排序
-    std::sort(m_modbusTags.begin(), m_modbusTags.end(), [](const ModbusTag& a, const ModbusTag& b)
-    {
-        if (a.slaveId != b.slaveId) return a.slaveId < b.slaveId;
-        return a.address < b.address;
-    });
-    // 遍历排序后的点位列表，合并请求
-    // 定义一个小的地址间隙，如果两个点位地址差在这个范围内就合并读取
-    const int MAX_ADDRESS_GAP = 5;
-    // 限制一次读取125个寄存器
-    const int MAX_READ_QUANTITY = 125;
-    for (const auto& tag : m_modbusTags)
+    // 按(优先级, 扫描周期)分组；键取负优先级使高优先级组排在前面
+    QMap<QPair<int, int>, QList<int>> groupedTags;
+    for (int i = 0; i < m_modbusTags.size(); ++i)
     {
-        // 计算点位的协议地址和所需寄存器数量
-        int tagProtocolAddr = tag.address - 40001;
-        int tagRegsCount = (tag.dataType == ModbusTag::DataType::Float32
-                               || tag.dataType == ModbusTag::DataType::Int32
-                               || tag.dataType == ModbusTag::DataType::UInt32)
-                               ? 2
-                               : 1;
-        if (m_readRequests.isEmpty() || tag.slaveId != m_readRequests.last().slaveId
-            || tagProtocolAddr > (m_readRequests.last().startAddress + m_readRequests.last().quantity + MAX_ADDRESS_GAP)
-            || (m_readRequests.last().quantity + (tagProtocolAddr - (m_readRequests.last().startAddress + m_readRequests
-                .last().quantity)) + tagRegsCount) > MAX_READ_QUANTITY)
-        {
-            // 如果满足以下任一条件，就创建一个新的请求：
-            // a. 这是第一个点位
-            // b. 点位的从站ID与上一个请求不同
-            // c. 点位的地址与上一个请求的地址范围差距太大
-            // d. 合并后会导致总读取数量超过Modbus协议限制
-            m_readRequests.append({tag.slaveId, tagProtocolAddr, tagRegsCount});
-        }
-        else
-        {
-            // 否则，扩展上一个请求的范围，以包含当前点位
-            int newQuantity = tagProtocolAddr - m_readRequests.last().startAddress + tagRegsCount;
-            m_readRequests.last().quantity = newQuantity;
-        }
+        const ModbusTag& tag = m_modbusTags[i];
+        int interval = tag.scanInterval > 0 ? tag.scanInterval : m_pPollIntervalSpinBox->value();
+        groupedTags[qMakePair(-tag.scanPriority, interval)].append(i);
     }
-    // 打印出优化后的请求列表，用于调试
-    for (const auto& req : m_readRequests)
+    // 组内由规划器按链路代价决定哪些点位合并读取，点位表本身的顺序保持不变
+    int requestCount = 0;
+    double scanTime = 0.0;
+    for (auto it = groupedTags.cbegin(); it != groupedTags.cend(); ++it)
     {
-        qDebug() << QString("Optimized Request -> Slave: %1, StartAddr: %2, Quantity: %3")
-                    .arg(req.slaveId).arg(req.startAddress).arg(req.quantity);
+        ModbusScanGroup group;
+        group.priority = -it.key().first;
+        group.interval = it.key().second;
+        double groupTime = 0.0;
+        group.requests = m_pRequestPlanner->plan(m_modbusTags, it.value(), &groupTime);
+        requestCount += group.requests.size();
+        scanTime += groupTime;
+        m_scanGroups.append(group);
     }
+    m_pLogTextEdit->appendPlainText(QString("请求规划: %1 个请求，预计扫描时间 %2 ms")
+                                    .arg(requestCount).arg(scanTime, 0, 'f', 1));
+}
+
+bool ModbusDisplayWidget::applyDecodeEntry(const ModbusDecodeEntry& entry, const QList<quint16>& values)
+{
+    double value = 0.0;
+    quint32 rawValue = 0;
+    if (!ModbusUtils::decodeValue(entry, values, value, rawValue)) return false;
+    ModbusTag& tag = m_modbusTags[entry.tagIndex];
+    // 原始值保存为数值，显示时再格式化
+    tag.rawValue = rawValue;
+    tag.currentValue = entry.isBit ? QVariant(rawValue) : QVariant(value);
+    m_pTagModel->valueUpdate(entry.tagIndex); // 通知UI更新
+    return true;
+}
+
+void ModbusDisplayWidget::stopPolling()
+{
+    m_isPolling = false;
+    m_pPollScheduler->stop();
+    m_pPollButton->setText("开始轮询");
+    this->setBusControlsEnabled(true);
+}
+
+void ModbusDisplayWidget::setBusControlsEnabled(bool enabled)
+{
+    m_pOperationsGroupBox->setEnabled(enabled);
+    m_pConfigTagsButton->setEnabled(enabled);
+    m_pPollIntervalSpinBox->setEnabled(enabled);
+    m_pTransportComboBox->setEnabled(enabled);
+    const bool isTcp = m_pModbusController->getTransport() == ModbusController::Transport::Tcp;
+    m_pMaxInFlightSpinBox->setEnabled(enabled && isTcp);
+    // 轮询和监听互斥，各自运行时禁用另一个
+    m_pPollButton->setEnabled(enabled || m_isPolling);
+    m_pSnifferButton->setEnabled((enabled && !isTcp) || m_pSniffer->isRunning());
 }
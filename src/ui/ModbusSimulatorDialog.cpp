@@ -0,0 +1,267 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusSimulatorDialog.cpp
+  * @author         : wangxiangyu
+  * @brief          : Modbus从站仿真器的配置与状态对话框实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "ui/ModbusSimulatorDialog.h"
+
+// 构造函数和析构函数
+ModbusSimulatorDialog::ModbusSimulatorDialog(QWidget* parent)
+    : QDialog(parent)
+{
+    // 仿真器放在独立线程，主站和从站不共用事件循环，测得的吞吐量更接近真实设备
+    m_pSimulatorThread = new QThread(this);
+    m_pSimulatorThread->setObjectName("ModbusSimulatorThread");
+    m_pSimulator = new ModbusSlaveSimulator();
+    m_pSimulator->moveToThread(m_pSimulatorThread);
+    this->connect(m_pSimulatorThread, &QThread::finished, m_pSimulator, &QObject::deleteLater);
+    m_pSimulatorThread->start();
+    this->setUI();
+}
+
+ModbusSimulatorDialog::~ModbusSimulatorDialog()
+{
+    QMetaObject::invokeMethod(m_pSimulator, &ModbusSlaveSimulator::stop, Qt::BlockingQueuedConnection);
+    m_pSimulatorThread->quit();
+    m_pSimulatorThread->wait();
+}
+
+void ModbusSimulatorDialog::onStartButtonToggled(bool checked)
+{
+    if (!checked)
+    {
+        QMetaObject::invokeMethod(m_pSimulator, &ModbusSlaveSimulator::stop);
+        return;
+    }
+    QList<QPair<int, int>> ranges;
+    if (!this->parseValidRanges(ranges))
+    {
+        CMessageBox::showToast(this, "有效地址格式错误，示例: 0-99,200-299");
+        m_pStartButton->setChecked(false);
+        return;
+    }
+    // 每行一个生成器："地址 = 表达式"，地址带数据区前缀
+    static const QRegularExpression generatorPattern(R"(^\s*(\d+)\s*=\s*(.+?)\s*$)");
+    QList<QPair<int, QString>> generators;
+    const QStringList lines = m_pGeneratorTextEdit->toPlainText().split('\n');
+    for (const QString& line : lines)
+    {
+        if (line.trimmed().isEmpty() || line.trimmed().startsWith("//")) continue;
+        QRegularExpressionMatch match = generatorPattern.match(line);
+        if (!match.hasMatch())
+        {
+            CMessageBox::showToast(this, QString("无法解析生成器: %1").arg(line.trimmed()));
+            m_pStartButton->setChecked(false);
+            return;
+        }
+        generators.append(qMakePair(match.captured(1).toInt(), match.captured(2)));
+    }
+    const bool isTcp = m_pLinkTypeComboBox->currentIndex() == 1;
+    const auto port = static_cast<quint16>(m_pTcpPortSpinBox->value());
+    const int slaveId = m_pSlaveIdSpinBox->value();
+    this->setConfigEnabled(false);
+    this->applyFaults();
+    ModbusSlaveSimulator* simulator = m_pSimulator;
+    QMetaObject::invokeMethod(m_pSimulator, [simulator, ranges, generators, isTcp, port, slaveId]()
+    {
+        simulator->setSlaveId(slaveId);
+        simulator->setValidRanges(ranges);
+        simulator->clearGenerators();
+        QStringList errors;
+        for (const auto& generator : generators)
+        {
+            QString errorMessage;
+            if (!simulator->addGenerator(generator.first, generator.second, &errorMessage))
+                errors.append(QString("生成器%1无效: %2").arg(generator.first).arg(errorMessage));
+        }
+        const bool isStarted = isTcp ? simulator->startTcp(port) : simulator->startPty();
+        // 启动成功后再报告无效的生成器，界面据此区分启动失败和生成器错误
+        if (isStarted && !errors.isEmpty()) emit simulator->errorOccurred(errors.join('\n'));
+    });
+}
+
+void ModbusSimulatorDialog::onLinkTypeChanged(int index)
+{
+    m_pTcpPortSpinBox->setEnabled(index == 1);
+    m_pCrcErrorRateSpinBox->setEnabled(index == 0);
+}
+
+void ModbusSimulatorDialog::onSimulatorStarted(const QString& endpoint)
+{
+    if (m_pLinkTypeComboBox->currentIndex() == 1)
+        m_pEndpointLabel->setText(QString("运行中: %1，在TCP客户端中连接该端口").arg(endpoint));
+    else
+        m_pEndpointLabel->setText(QString("运行中: %1，在串口配置中打开该设备").arg(endpoint));
+    m_pEndpointLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+}
+
+void ModbusSimulatorDialog::onSimulatorStopped()
+{
+    m_pEndpointLabel->setText("未运行");
+    this->setConfigEnabled(true);
+    m_pStartButton->blockSignals(true);
+    m_pStartButton->setChecked(false);
+    m_pStartButton->blockSignals(false);
+}
+
+void ModbusSimulatorDialog::onSimulatorError(const QString& message)
+{
+    CMessageBox::showToast(this, message);
+    // 启动失败时仿真器不会发出stopped()，在这里恢复界面
+    if (m_pStartButton->isChecked() && m_pEndpointLabel->text() == "未运行") this->onSimulatorStopped();
+}
+
+void ModbusSimulatorDialog::onStatisticsUpdated(const ModbusSimulatorStatistics& statistics)
+{
+    m_pStatisticsLabel->setText(QString("请求 %1 (%2/s)  应答 %3  异常 %4  CRC错误 %5  丢弃 %6")
+                                .arg(statistics.requestCount).arg(statistics.requestRate, 0, 'f', 1)
+                                .arg(statistics.responseCount).arg(statistics.exceptionCount)
+                                .arg(statistics.crcErrorCount).arg(statistics.dropCount));
+}
+
+void ModbusSimulatorDialog::applyFaults()
+{
+    // 故障参数运行中也可以调整
+    ModbusSimulatorFaults faults;
+    faults.minLatency = m_pMinLatencySpinBox->value();
+    faults.maxLatency = m_pMaxLatencySpinBox->value();
+    faults.exceptionRate = m_pExceptionRateSpinBox->value() / 100.0;
+    faults.crcErrorRate = m_pCrcErrorRateSpinBox->value() / 100.0;
+    faults.dropRate = m_pDropRateSpinBox->value() / 100.0;
+    ModbusSlaveSimulator* simulator = m_pSimulator;
+    QMetaObject::invokeMethod(m_pSimulator, [simulator, faults]() { simulator->setFaults(faults); });
+}
+
+void ModbusSimulatorDialog::setUI()
+{
+    this->setWindowTitle("Modbus从站仿真");
+    this->setMinimumSize(420, 520);
+    this->createComponents();
+    this->createLayout();
+    this->connectSignals();
+    this->onLinkTypeChanged(m_pLinkTypeComboBox->currentIndex());
+}
+
+void ModbusSimulatorDialog::createComponents()
+{
+    m_pLinkTypeComboBox = new QComboBox(this);
+    m_pLinkTypeComboBox->addItem("伪终端 (RTU)");
+    m_pLinkTypeComboBox->addItem("TCP端口 (TCP)");
+#ifndef Q_OS_LINUX
+    m_pLinkTypeComboBox->setCurrentIndex(1);
+#endif
+    m_pTcpPortSpinBox = new QSpinBox(this);
+    m_pTcpPortSpinBox->setRange(1, 65535);
+    m_pTcpPortSpinBox->setValue(1502);
+    m_pSlaveIdSpinBox = new QSpinBox(this);
+    m_pSlaveIdSpinBox->setRange(1, 247);
+    m_pValidRangesLineEdit = new QLineEdit("0-9999", this);
+    m_pValidRangesLineEdit->setToolTip("协议地址区间(从0开始)，访问区间外的地址时应答0x02异常");
+
+    m_pMinLatencySpinBox = new QSpinBox(this);
+    m_pMinLatencySpinBox->setRange(0, 10000);
+    m_pMinLatencySpinBox->setSuffix(" ms");
+    m_pMaxLatencySpinBox = new QSpinBox(this);
+    m_pMaxLatencySpinBox->setRange(0, 10000);
+    m_pMaxLatencySpinBox->setSuffix(" ms");
+    m_pExceptionRateSpinBox = new QDoubleSpinBox(this);
+    m_pCrcErrorRateSpinBox = new QDoubleSpinBox(this);
+    m_pDropRateSpinBox = new QDoubleSpinBox(this);
+    for (QDoubleSpinBox* spinBox : {m_pExceptionRateSpinBox, m_pCrcErrorRateSpinBox, m_pDropRateSpinBox})
+    {
+        spinBox->setRange(0, 100);
+        spinBox->setDecimals(1);
+        spinBox->setSuffix(" %");
+    }
+
+    m_pGeneratorTextEdit = new QPlainTextEdit(this);
+    m_pGeneratorTextEdit->setPlaceholderText("每行一个: 地址 = 表达式，可用t(秒)和n(刷新次数)\n"
+                                             "40001 = Math.round(1000 * Math.sin(t))\n"
+                                             "30001 = n % 100\n"
+                                             "1 = Math.floor(t) % 2");
+
+    m_pEndpointLabel = new QLabel("未运行", this);
+    m_pEndpointLabel->setWordWrap(true);
+    m_pStatisticsLabel = new QLabel(this);
+    m_pStartButton = new QPushButton("启动仿真", this);
+    m_pStartButton->setCheckable(true);
+}
+
+void ModbusSimulatorDialog::createLayout()
+{
+    auto mainLayout = new QVBoxLayout(this);
+    m_pFormLayout = new QFormLayout();
+
+    auto latencyLayout = new QHBoxLayout();
+    latencyLayout->addWidget(m_pMinLatencySpinBox);
+    latencyLayout->addWidget(new QLabel("~", this));
+    latencyLayout->addWidget(m_pMaxLatencySpinBox);
+
+    m_pFormLayout->addRow("链路:", m_pLinkTypeComboBox);
+    m_pFormLayout->addRow("TCP端口:", m_pTcpPortSpinBox);
+    m_pFormLayout->addRow("从站地址:", m_pSlaveIdSpinBox);
+    m_pFormLayout->addRow("有效地址:", m_pValidRangesLineEdit);
+    m_pFormLayout->addRow("应答延迟:", latencyLayout);
+    m_pFormLayout->addRow("异常应答率:", m_pExceptionRateSpinBox);
+    m_pFormLayout->addRow("CRC错误率:", m_pCrcErrorRateSpinBox);
+    m_pFormLayout->addRow("丢帧率:", m_pDropRateSpinBox);
+
+    mainLayout->addLayout(m_pFormLayout);
+    mainLayout->addWidget(new QLabel("值生成器:", this));
+    mainLayout->addWidget(m_pGeneratorTextEdit);
+    mainLayout->addWidget(m_pEndpointLabel);
+    mainLayout->addWidget(m_pStatisticsLabel);
+    mainLayout->addWidget(m_pStartButton, 0, Qt::AlignRight);
+}
+
+void ModbusSimulatorDialog::connectSignals()
+{
+    this->connect(m_pStartButton, &QPushButton::toggled, this, &ModbusSimulatorDialog::onStartButtonToggled);
+    this->connect(m_pLinkTypeComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this,
+                  &ModbusSimulatorDialog::onLinkTypeChanged);
+    this->connect(m_pSimulator, &ModbusSlaveSimulator::started, this, &ModbusSimulatorDialog::onSimulatorStarted);
+    this->connect(m_pSimulator, &ModbusSlaveSimulator::stopped, this, &ModbusSimulatorDialog::onSimulatorStopped);
+    this->connect(m_pSimulator, &ModbusSlaveSimulator::errorOccurred, this, &ModbusSimulatorDialog::onSimulatorError);
+    this->connect(m_pSimulator, &ModbusSlaveSimulator::statisticsUpdated, this,
+                  &ModbusSimulatorDialog::onStatisticsUpdated);
+    this->connect(m_pMinLatencySpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
+                  &ModbusSimulatorDialog::applyFaults);
+    this->connect(m_pMaxLatencySpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
+                  &ModbusSimulatorDialog::applyFaults);
+    for (QDoubleSpinBox* spinBox : {m_pExceptionRateSpinBox, m_pCrcErrorRateSpinBox, m_pDropRateSpinBox})
+    {
+        this->connect(spinBox, QOverload<double>::of(&QDoubleSpinBox::valueChanged), this,
+                      &ModbusSimulatorDialog::applyFaults);
+    }
+}
+
+void ModbusSimulatorDialog::setConfigEnabled(bool enabled)
+{
+    m_pLinkTypeComboBox->setEnabled(enabled);
+    m_pTcpPortSpinBox->setEnabled(enabled && m_pLinkTypeComboBox->currentIndex() == 1);
+    m_pSlaveIdSpinBox->setEnabled(enabled);
+    m_pValidRangesLineEdit->setEnabled(enabled);
+    m_pGeneratorTextEdit->setReadOnly(!enabled);
+    m_pStartButton->setText(enabled ? "启动仿真" : "停止仿真");
+}
+
+bool ModbusSimulatorDialog::parseValidRanges(QList<QPair<int, int>>& ranges) const
+{
+    static const QRegularExpression rangePattern(R"(^\s*(\d+)\s*(?:-\s*(\d+)\s*)?$)");
+    const QStringList items = m_pValidRangesLineEdit->text().split(',', Qt::SkipEmptyParts);
+    for (const QString& item : items)
+    {
+        QRegularExpressionMatch match = rangePattern.match(item);
+        if (!match.hasMatch()) return false;
+        const int first = match.captured(1).toInt();
+        const int last = match.captured(2).isEmpty() ? first : match.captured(2).toInt();
+        if (first > last || last > 65535) return false;
+        ranges.append(qMakePair(first, last));
+    }
+    return !ranges.isEmpty();
+}
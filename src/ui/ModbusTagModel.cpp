@@ -10,6 +10,11 @@
 ModbusTagModel::ModbusTagModel(QList<ModbusTag>* tags, QObject* parent)
     : QAbstractTableModel(parent), m_tags(tags)
 {
+    m_pRefreshTimer = new QTimer(this);
+    m_pRefreshTimer->setSingleShot(true);
+    m_pRefreshTimer->setInterval(REFRESH_INTERVAL);
+    m_pRefreshTimer->setTimerType(Qt::PreciseTimer);
+    this->connect(m_pRefreshTimer, &QTimer::timeout, this, &ModbusTagModel::flushDirtyRows);
 }
 
 int ModbusTagModel::rowCount(const QModelIndex& parent) const
@@ -59,14 +64,7 @@ QVariant ModbusTagModel::data(const QModelIndex& index, int role) const
         {
         case 0: return tag.name;
         case 1: return tag.currentValue.isValid() ? tag.currentValue : "N/A"; // 显示换算后的当前值
-        case 2: // 将原始值显示为十六进制
-            {
-                if (!tag.rawValue.isValid()) return "N/A";
-                bool ok;
-                // 支持不同长度的原始值
-                quint64 raw = tag.rawValue.toULongLong(&ok);
-                return ok ? QString("0x%1").arg(raw, 4, 16, QChar('0')).toUpper() : "N/A";
-            }
+        case 2: return this->hexText(index.row()); // 将原始值显示为十六进制
         case 3: return tag.rawValue.isValid() ? tag.rawValue : "N/A"; // 显示原始值
         default: return QVariant();
         }
@@ -78,6 +76,9 @@ void ModbusTagModel::layoutRefresh()
 {
     // beginResetModel/endResetModel 会通知所有连接的视图：数据已完全重置，请刷新所有内容
     this->beginResetModel();
+    m_displayCache.clear();
+    m_pRefreshTimer->stop();
+    m_dirtyFirst = m_dirtyLast = -1;
     this->endResetModel();
 }
 
@@ -85,10 +86,44 @@ void ModbusTagModel::valueUpdate(int rowIndex)
 {
     if (rowIndex < 0 || rowIndex >= m_tags->size()) return;
 
-    // 创建一个只包含已更改单元格的索引范围
-    QModelIndex topLeft = index(rowIndex, 1); // "当前值"列
-    QModelIndex bottomRight = index(rowIndex, 3); // "原始值"列
+    if (rowIndex < m_displayCache.size()) m_displayCache[rowIndex].isValid = false;
+    // 一个响应会更新大量点位，逐个发射dataChanged会让视图重复重绘，这里只扩大脏行范围
+    if (m_dirtyFirst < 0)
+    {
+        m_dirtyFirst = m_dirtyLast = rowIndex;
+    }
+    else
+    {
+        m_dirtyFirst = qMin(m_dirtyFirst, rowIndex);
+        m_dirtyLast = qMax(m_dirtyLast, rowIndex);
+    }
+    if (!m_pRefreshTimer->isActive()) m_pRefreshTimer->start();
+}
 
-    // 发射 dataChanged 信号，只通知视图刷新指定区域，效率更高
-    emit dataChanged(topLeft, bottomRight, {Qt::DisplayRole});
+void ModbusTagModel::flushDirtyRows()
+{
+    if (m_dirtyFirst < 0) return;
+    const int lastRow = qMin(m_dirtyLast, static_cast<int>(m_tags->size()) - 1);
+    // 创建只包含已更改单元格的索引范围："当前值"列到"原始值"列
+    // 视图收到后只重绘可见区域，不可见行的文本不会被格式化
+    if (m_dirtyFirst <= lastRow) emit dataChanged(index(m_dirtyFirst, 1), index(lastRow, 3), {Qt::DisplayRole});
+    m_dirtyFirst = m_dirtyLast = -1;
+}
+
+QString ModbusTagModel::hexText(int row) const
+{
+    if (m_displayCache.size() != m_tags->size()) m_displayCache.resize(m_tags->size());
+    DisplayCache& cache = m_displayCache[row];
+    if (cache.isValid) return cache.hexText;
+    const ModbusTag& tag = m_tags->at(row);
+    cache.hexText = "N/A";
+    if (tag.rawValue.isValid())
+    {
+        bool ok;
+        // 支持不同长度的原始值
+        quint64 raw = tag.rawValue.toULongLong(&ok);
+        if (ok) cache.hexText = QString("0x%1").arg(raw, 4, 16, QChar('0')).toUpper();
+    }
+    cache.isValid = true;
+    return cache.hexText;
 }
@@ -0,0 +1,147 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusTransactionLogModel.cpp
+  * @author         : wangxiangyu
+  * @brief          : Modbus事务记录的 TableView 模型实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "ui/ModbusTransactionLogModel.h"
+
+ModbusTransactionLogModel::ModbusTransactionLogModel(QObject* parent) : QAbstractTableModel(parent)
+{
+    m_pRefreshTimer = new QTimer(this);
+    m_pRefreshTimer->setSingleShot(true);
+    m_pRefreshTimer->setInterval(REFRESH_INTERVAL);
+    this->connect(m_pRefreshTimer, &QTimer::timeout, this, &ModbusTransactionLogModel::flushPendingRows);
+}
+
+int ModbusTransactionLogModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid()) return 0;
+    return m_shownRows;
+}
+
+int ModbusTransactionLogModel::columnCount(const QModelIndex& parent) const
+{
+    if (parent.isValid()) return 0;
+    return ColumnCount;
+}
+
+QVariant ModbusTransactionLogModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_shownRows) return QVariant();
+    const ModbusTransactionRecord& record = m_log.at(m_hiddenRows + index.row());
+    if (role == Qt::ForegroundRole && index.column() == ResultColumn)
+    {
+        return record.result == ModbusTransactionRecord::Result::Success ? QVariant() : QColor(Qt::red);
+    }
+    if (role != Qt::DisplayRole) return QVariant();
+    switch (index.column())
+    {
+    case TimeColumn: return QDateTime::fromMSecsSinceEpoch(record.timestamp).toString("HH:mm:ss.zzz");
+    case SlaveColumn: return record.slaveId;
+    case FunctionColumn: return "0x" + QString("%1").arg(record.functionCode, 2, 16, QChar('0')).toUpper();
+    case AddressColumn: return record.address + ModbusUtils::addressBase(record.functionCode);
+    case QuantityColumn: return record.quantity;
+    case LatencyColumn: return QString::number(record.latency, 'f', 2);
+    case ResultColumn: return resultText(record);
+    case RequestColumn: return QString::fromLatin1(record.request.toHex(' ').toUpper());
+    case ResponseColumn: return QString::fromLatin1(record.response.toHex(' ').toUpper());
+    default: return QVariant();
+    }
+}
+
+QVariant ModbusTransactionLogModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role != Qt::DisplayRole) return QVariant();
+    if (orientation == Qt::Vertical) return section + 1;
+    switch (section)
+    {
+    case TimeColumn: return "时间";
+    case SlaveColumn: return "从站";
+    case FunctionColumn: return "功能码";
+    case AddressColumn: return "地址";
+    case QuantityColumn: return "数量";
+    case LatencyColumn: return "耗时(ms)";
+    case ResultColumn: return "结果";
+    case RequestColumn: return "请求帧";
+    case ResponseColumn: return "响应帧";
+    default: return QVariant();
+    }
+}
+
+const ModbusTransactionLog& ModbusTransactionLogModel::getLog() const
+{
+    return m_log;
+}
+
+void ModbusTransactionLogModel::append(const ModbusTransactionRecord& record)
+{
+    // 先放入待显示队列，按周期在行插入通知中写入环形存储，已显示的行与记录的对应关系始终不变
+    m_pendingRecords.append(record);
+    if (m_pendingRecords.size() >= m_log.capacity()) this->flushPendingRows();
+    else if (!m_pRefreshTimer->isActive()) m_pRefreshTimer->start();
+}
+
+void ModbusTransactionLogModel::clear()
+{
+    this->beginResetModel();
+    m_log.clear();
+    m_pendingRecords.clear();
+    m_pRefreshTimer->stop();
+    m_shownRows = 0;
+    m_hiddenRows = 0;
+    this->endResetModel();
+}
+
+void ModbusTransactionLogModel::flushPendingRows()
+{
+    m_pRefreshTimer->stop();
+    const int added = m_pendingRecords.size();
+    if (added == 0) return;
+    if (added >= m_log.capacity())
+    {
+        // 一个周期内的新记录已超过容量，直接整体刷新
+        this->beginResetModel();
+        for (int i = added - m_log.capacity(); i < added; ++i) m_log.append(m_pendingRecords[i]);
+        m_pendingRecords.clear();
+        m_shownRows = m_log.size();
+        this->endResetModel();
+        return;
+    }
+    // 环形存储将要覆盖的最旧记录先从表头移除，移除后到写入前按偏移跳过这些记录
+    const int removed = qMax(0, m_shownRows + added - m_log.capacity());
+    if (removed > 0)
+    {
+        this->beginRemoveRows(QModelIndex(), 0, removed - 1);
+        m_hiddenRows = removed;
+        m_shownRows -= removed;
+        this->endRemoveRows();
+    }
+    this->beginInsertRows(QModelIndex(), m_shownRows, m_shownRows + added - 1);
+    for (const ModbusTransactionRecord& record : qAsConst(m_pendingRecords)) m_log.append(record);
+    m_pendingRecords.clear();
+    m_hiddenRows = 0;
+    m_shownRows = m_log.size();
+    this->endInsertRows();
+}
+
+QString ModbusTransactionLogModel::resultText(const ModbusTransactionRecord& record)
+{
+    QString text;
+    switch (record.result)
+    {
+    case ModbusTransactionRecord::Result::Success: text = "成功"; break;
+    case ModbusTransactionRecord::Result::Exception:
+        text = "异常 0x" + QString("%1").arg(record.exceptionCode, 2, 16, QChar('0')).toUpper();
+        break;
+    case ModbusTransactionRecord::Result::InvalidResponse: text = "响应无效"; break;
+    case ModbusTransactionRecord::Result::Timeout: text = "超时"; break;
+    case ModbusTransactionRecord::Result::CrcError: text = "CRC错误"; break;
+    }
+    if (record.attempt > 0) text += QString(" (重试%1)").arg(record.attempt);
+    return text;
+}
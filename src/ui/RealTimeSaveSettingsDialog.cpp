@@ -0,0 +1,167 @@
+/**
+  ******************************************************************************
+  * @file           : RealTimeSaveSettingsDialog.cpp
+  * @author         : wangxiangyu
+  * @brief          : 实时保存分段设置对话框实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "ui/RealTimeSaveSettingsDialog.h"
+
+#include <QStyle>
+
+// 构造函数和析构函数
+RealTimeSaveSettingsDialog::RealTimeSaveSettingsDialog(QWidget* parent)
+    : CDialogBase(parent, "实时保存设置", QSize(420, 400))
+{
+    this->setUI();
+    // 使用事件循环后加载样式确保所有组件都已创建
+    QMetaObject::invokeMethod(this, [this]()
+    {
+        QString parentStyleSheet = this->styleSheet();
+        QString childStyleSheet = StyleLoader::loadStyleFromFileToString(
+            ":/resources/qss/real_time_save_settings_dialog.qss");
+        this->setStyleSheet(parentStyleSheet + childStyleSheet);
+        this->style()->unpolish(this);
+        this->style()->polish(this);
+        this->update();
+    }, Qt::QueuedConnection);
+}
+
+// 获取方法
+LogRotationConfig RealTimeSaveSettingsDialog::getRotationConfig() const
+{
+    LogRotationConfig config;
+    config.maxSegmentBytes = qint64(m_pSegmentSizeSpinBox->value()) * 1024 * 1024;
+    config.maxSegmentSeconds = m_pSegmentDurationSpinBox->value() * 60;
+    const QString nameTemplate = m_pNameTemplateLineEdit->text().trimmed();
+    if (!nameTemplate.isEmpty()) config.nameTemplate = nameTemplate;
+    config.compressClosedSegments = m_pCompressCheckBox->isChecked();
+    config.maxTotalBytes = qint64(m_pMaxTotalSizeSpinBox->value()) * 1024 * 1024;
+    return config;
+}
+
+RealTimeSaveSettingsDialog::SaveContent RealTimeSaveSettingsDialog::getSaveContent() const
+{
+    return m_pSaveContentComboBox->currentData().value<SaveContent>();
+}
+
+AsyncFileWriter::SyncPolicy RealTimeSaveSettingsDialog::getSyncPolicy() const
+{
+    return m_pSyncPolicyComboBox->currentData().value<AsyncFileWriter::SyncPolicy>();
+}
+
+// 配置方法
+void RealTimeSaveSettingsDialog::setRotationConfig(const LogRotationConfig& config)
+{
+    m_pSegmentSizeSpinBox->setValue(static_cast<int>(config.maxSegmentBytes / (1024 * 1024)));
+    m_pSegmentDurationSpinBox->setValue(config.maxSegmentSeconds / 60);
+    m_pNameTemplateLineEdit->setText(config.nameTemplate);
+    m_pCompressCheckBox->setChecked(config.compressClosedSegments);
+    m_pMaxTotalSizeSpinBox->setValue(static_cast<int>(config.maxTotalBytes / (1024 * 1024)));
+    this->updateRotationWidgets();
+}
+
+void RealTimeSaveSettingsDialog::setSaveContent(SaveContent content)
+{
+    const int index = m_pSaveContentComboBox->findData(QVariant::fromValue(content));
+    if (index >= 0) m_pSaveContentComboBox->setCurrentIndex(index);
+}
+
+void RealTimeSaveSettingsDialog::setSyncPolicy(AsyncFileWriter::SyncPolicy policy)
+{
+    const int index = m_pSyncPolicyComboBox->findData(QVariant::fromValue(policy));
+    if (index >= 0) m_pSyncPolicyComboBox->setCurrentIndex(index);
+}
+
+// 重写基类虚函数
+void RealTimeSaveSettingsDialog::createComponents()
+{
+    m_pSaveContentComboBox = new QComboBox(this);
+    m_pSaveContentComboBox->addItem("格式化文本", QVariant::fromValue(SaveContent::Text));
+    m_pSaveContentComboBox->addItem("原始字节", QVariant::fromValue(SaveContent::Raw));
+    m_pSaveContentComboBox->addItem("原始字节 + 格式化文本", QVariant::fromValue(SaveContent::RawAndText));
+    m_pSaveContentComboBox->setToolTip("原始字节保存为同名.sdtr文件，记录时间戳、收发方向和来源，可精确回放");
+
+    m_pSyncPolicyComboBox = new QComboBox(this);
+    m_pSyncPolicyComboBox->addItem("不主动落盘", QVariant::fromValue(AsyncFileWriter::SyncPolicy::None));
+    m_pSyncPolicyComboBox->addItem("每秒落盘", QVariant::fromValue(AsyncFileWriter::SyncPolicy::Periodic));
+    m_pSyncPolicyComboBox->addItem("每次写入后落盘", QVariant::fromValue(AsyncFileWriter::SyncPolicy::OnCommit));
+    m_pSyncPolicyComboBox->setToolTip("落盘越频繁，断电时丢失的数据越少，但写入开销越大；程序崩溃时已写入的数据不会丢失");
+
+    m_pSegmentSizeSpinBox = new QSpinBox(this);
+    m_pSegmentSizeSpinBox->setRange(0, 1024 * 1024);
+    m_pSegmentSizeSpinBox->setSuffix(" MB");
+    m_pSegmentSizeSpinBox->setSpecialValueText("不分段");
+
+    m_pSegmentDurationSpinBox = new QSpinBox(this);
+    m_pSegmentDurationSpinBox->setRange(0, 7 * 24 * 60);
+    m_pSegmentDurationSpinBox->setSuffix(" 分钟");
+    m_pSegmentDurationSpinBox->setSpecialValueText("不分段");
+
+    m_pNameTemplateLineEdit = new QLineEdit(this);
+    m_pNameTemplateLineEdit->setText(LogRotationConfig().nameTemplate);
+    m_pNameTemplateLineEdit->setToolTip("可用占位符：{name} {suffix} {index} {date} {time}");
+
+    m_pCompressCheckBox = new QCheckBox("压缩已关闭的分段(.gz)", this);
+
+    m_pMaxTotalSizeSpinBox = new QSpinBox(this);
+    m_pMaxTotalSizeSpinBox->setRange(0, 1024 * 1024);
+    m_pMaxTotalSizeSpinBox->setSuffix(" MB");
+    m_pMaxTotalSizeSpinBox->setSpecialValueText("不限制");
+    m_pMaxTotalSizeSpinBox->setToolTip("超过上限时删除最早的分段");
+
+    if (m_pTitleLabel) m_pTitleLabel->setObjectName("titleLabel");
+    if (m_pCancelButton) m_pCancelButton->setObjectName("cancelButton");
+    if (m_pConfirmButton) m_pConfirmButton->setObjectName("confirmButton");
+    this->updateRotationWidgets();
+}
+
+void RealTimeSaveSettingsDialog::createContentLayout()
+{
+    if (!m_pContentLayout) return;
+
+    QFormLayout* formLayout = new QFormLayout();
+    formLayout->addRow("保存内容：", m_pSaveContentComboBox);
+    formLayout->addRow("落盘策略：", m_pSyncPolicyComboBox);
+    formLayout->addRow("分段大小：", m_pSegmentSizeSpinBox);
+    formLayout->addRow("分段时长：", m_pSegmentDurationSpinBox);
+    formLayout->addRow("分段命名：", m_pNameTemplateLineEdit);
+    formLayout->addRow("", m_pCompressCheckBox);
+    formLayout->addRow("磁盘上限：", m_pMaxTotalSizeSpinBox);
+
+    m_pContentLayout->addLayout(formLayout);
+}
+
+void RealTimeSaveSettingsDialog::connectSignals()
+{
+    this->connect(m_pSegmentSizeSpinBox, &QSpinBox::valueChanged, this,
+                  &RealTimeSaveSettingsDialog::updateRotationWidgets);
+    this->connect(m_pSegmentDurationSpinBox, &QSpinBox::valueChanged, this,
+                  &RealTimeSaveSettingsDialog::updateRotationWidgets);
+}
+
+void RealTimeSaveSettingsDialog::onConfirmClicked()
+{
+    CDialogBase::onConfirmClicked();
+}
+
+// 私有方法
+void RealTimeSaveSettingsDialog::setUI()
+{
+    this->setAttribute(Qt::WA_StyledBackground, true);
+    this->createComponents();
+    this->createContentLayout();
+    this->connectSignals();
+}
+
+void RealTimeSaveSettingsDialog::updateRotationWidgets()
+{
+    // 未启用分段时命名、压缩和磁盘上限都不生效
+    const bool enabled = m_pSegmentSizeSpinBox->value() > 0 || m_pSegmentDurationSpinBox->value() > 0;
+    m_pNameTemplateLineEdit->setEnabled(enabled);
+    m_pCompressCheckBox->setEnabled(enabled);
+    m_pMaxTotalSizeSpinBox->setEnabled(enabled);
+}
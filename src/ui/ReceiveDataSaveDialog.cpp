@@ -0,0 +1,112 @@
+/**
+  ******************************************************************************
+  * @file           : ReceiveDataSaveDialog.cpp
+  * @author         : wangxiangyu
+  * @brief          : 保存接收数据的筛选条件对话框实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "ui/ReceiveDataSaveDialog.h"
+
+#include <QStyle>
+
+// 构造函数和析构函数
+ReceiveDataSaveDialog::ReceiveDataSaveDialog(QWidget* parent)
+    : CDialogBase(parent, "保存接收数据", QSize(420, 300))
+{
+    this->setUI();
+    // 使用事件循环后加载样式确保所有组件都已创建
+    QMetaObject::invokeMethod(this, [this]()
+    {
+        QString parentStyleSheet = this->styleSheet();
+        QString childStyleSheet = StyleLoader::loadStyleFromFileToString(
+            ":/resources/qss/receive_data_save_dialog.qss");
+        this->setStyleSheet(parentStyleSheet + childStyleSheet);
+        this->style()->unpolish(this);
+        this->style()->polish(this);
+        this->update();
+    }, Qt::QueuedConnection);
+}
+
+// 获取方法
+ReceiveRecordFilter ReceiveDataSaveDialog::getFilter() const
+{
+    ReceiveRecordFilter filter;
+    if (m_pTimeRangeCheckBox->isChecked())
+    {
+        filter.startTime = m_pStartTimeEdit->dateTime().toMSecsSinceEpoch();
+        // 时间编辑框精确到秒，结束时间包含整秒
+        filter.endTime = m_pEndTimeEdit->dateTime().toMSecsSinceEpoch() + 999;
+    }
+    filter.keyword = m_pKeywordLineEdit->text();
+    filter.caseSensitivity = m_pCaseSensitiveCheckBox->isChecked() ? Qt::CaseSensitive : Qt::CaseInsensitive;
+    return filter;
+}
+
+// 配置方法
+void ReceiveDataSaveDialog::setTimeRange(qint64 startTime, qint64 endTime)
+{
+    const QDateTime now = QDateTime::currentDateTime();
+    m_pStartTimeEdit->setDateTime(startTime > 0 ? QDateTime::fromMSecsSinceEpoch(startTime) : now);
+    m_pEndTimeEdit->setDateTime(endTime > 0 ? QDateTime::fromMSecsSinceEpoch(endTime) : now);
+}
+
+// 重写基类虚函数
+void ReceiveDataSaveDialog::createComponents()
+{
+    m_pTimeRangeCheckBox = new QCheckBox("仅保存时间范围内的数据", this);
+
+    m_pStartTimeEdit = new QDateTimeEdit(this);
+    m_pStartTimeEdit->setDisplayFormat("yyyy-MM-dd HH:mm:ss");
+    m_pStartTimeEdit->setEnabled(false);
+
+    m_pEndTimeEdit = new QDateTimeEdit(this);
+    m_pEndTimeEdit->setDisplayFormat("yyyy-MM-dd HH:mm:ss");
+    m_pEndTimeEdit->setEnabled(false);
+
+    m_pKeywordLineEdit = new QLineEdit(this);
+    m_pKeywordLineEdit->setPlaceholderText("只保存包含该关键字的行，留空保存全部");
+
+    m_pCaseSensitiveCheckBox = new QCheckBox("区分大小写", this);
+
+    if (m_pTitleLabel) m_pTitleLabel->setObjectName("titleLabel");
+    if (m_pCancelButton) m_pCancelButton->setObjectName("cancelButton");
+    if (m_pConfirmButton) m_pConfirmButton->setObjectName("confirmButton");
+    this->setTimeRange(0, 0);
+}
+
+void ReceiveDataSaveDialog::createContentLayout()
+{
+    if (!m_pContentLayout) return;
+
+    QFormLayout* formLayout = new QFormLayout();
+    formLayout->addRow("", m_pTimeRangeCheckBox);
+    formLayout->addRow("开始时间：", m_pStartTimeEdit);
+    formLayout->addRow("结束时间：", m_pEndTimeEdit);
+    formLayout->addRow("关键字：", m_pKeywordLineEdit);
+    formLayout->addRow("", m_pCaseSensitiveCheckBox);
+
+    m_pContentLayout->addLayout(formLayout);
+}
+
+void ReceiveDataSaveDialog::connectSignals()
+{
+    this->connect(m_pTimeRangeCheckBox, &QCheckBox::toggled, m_pStartTimeEdit, &QDateTimeEdit::setEnabled);
+    this->connect(m_pTimeRangeCheckBox, &QCheckBox::toggled, m_pEndTimeEdit, &QDateTimeEdit::setEnabled);
+}
+
+void ReceiveDataSaveDialog::onConfirmClicked()
+{
+    CDialogBase::onConfirmClicked();
+}
+
+// 私有方法
+void ReceiveDataSaveDialog::setUI()
+{
+    this->setAttribute(Qt::WA_StyledBackground, true);
+    this->createComponents();
+    this->createContentLayout();
+    this->connectSignals();
+}
@@ -12,7 +12,7 @@
 
 // 构造函数和析构函数
 SerialPortConfigTab::SerialPortConfigTab(QWidget* parent)
-    : QWidget(parent), m_pSaveFile(nullptr)
+    : QWidget(parent)
 {
     this->setUI();
     StyleLoader::loadStyleFromFile(this, ":resources/qss/serial_prot_config_tab.qss");
@@ -22,9 +22,8 @@ void SerialPortConfigTab::onReadySaveFile(bool status)
 {
     if (!status)
     {
-        // 自动释放内存
-        QScopedPointer<QFile> fileGuard(m_pSaveFile);
-        m_pSaveFile = nullptr;
+        // 写出剩余数据后关闭文件
+        this->closeSaveWriters();
         m_pSerialPortRealTimeSaveWidget->hide();
         emit displaySavePathRequested();
         return;
@@ -38,22 +37,26 @@ void SerialPortConfigTab::onReadySaveFile(bool status)
         m_pSerialPortReceiveSettingsWidget->getSaveToFileCheckBox()->setChecked(false);
         return;
     }
-    // 使用 Qt 智能指针
-    QScopedPointer<QFile> newFile(new QFile(fileName));
-    if (!newFile->open(QIODevice::WriteOnly | QIODevice::Text)) return;
-    // 替换全局文件对象
-    delete m_pSaveFile;
-    m_pSaveFile = newFile.take(); // 获取所有权
-    emit displaySavePathRequested(fileName);
-    QTextStream out(m_pSaveFile);
-    QString dataStr = SerialPortDataReceiveWidget::getReceiveTextEdit()->toPlainText();
-    // 如果数据不以换行符结尾，则添加换行符
-    if (!dataStr.endsWith('\n'))
+    // 长时间采集时按大小/时长分段保存
+    RealTimeSaveSettingsDialog* settingsDialog = new RealTimeSaveSettingsDialog(this);
+    settingsDialog->setRotationConfig(m_pSaveWriter->getRotationConfig());
+    settingsDialog->setSaveContent(m_saveContent);
+    settingsDialog->setSyncPolicy(m_pRawCaptureWriter->getSyncPolicy());
+    const bool accepted = settingsDialog->exec() == QDialog::Accepted;
+    if (accepted)
     {
-        dataStr.append('\n');
+        m_pSaveWriter->setRotationConfig(settingsDialog->getRotationConfig());
+        m_pRawCaptureWriter->setRotationConfig(settingsDialog->getRotationConfig());
+        m_saveContent = settingsDialog->getSaveContent();
+        m_pSaveWriter->setSyncPolicy(settingsDialog->getSyncPolicy());
+        m_pRawCaptureWriter->setSyncPolicy(settingsDialog->getSyncPolicy());
+    }
+    QTimer::singleShot(0, settingsDialog, &RealTimeSaveSettingsDialog::deleteLater);
+    if (!accepted || !this->openSaveWriters(fileName))
+    {
+        m_pSerialPortReceiveSettingsWidget->getSaveToFileCheckBox()->setChecked(false);
+        return;
     }
-    out << dataStr;
-    m_pSaveFile->flush();
     m_pSerialPortRealTimeSaveWidget->show();
 }
 
@@ -77,6 +80,14 @@ void SerialPortConfigTab::createComponents()
     m_pContentPanel = new QWidget(this); // 右侧容器
     m_pSerialPortRealTimeSaveWidget = new SerialPortRealTimeSaveWidget(m_pContentPanel);
     m_pSerialPortRealTimeSaveWidget->hide();
+    m_pSaveWriter = new AsyncFileWriter(this);
+    m_pRawCaptureWriter = new AsyncFileWriter(this);
+    m_pRawCaptureWriter->setSegmentHeader(RawCapture::encodeFileHeader());
+    // 原始字节直接写入预分配的映射文件，崩溃时最多丢失最后一次落盘后的数据
+    m_pRawCaptureWriter->setStorageMode(AsyncFileWriter::StorageMode::Mapped);
+    // 默认每秒落盘，可在实时保存设置中修改，文本和原始字节使用同一策略
+    m_pSaveWriter->setSyncPolicy(AsyncFileWriter::SyncPolicy::Periodic);
+    m_pRawCaptureWriter->setSyncPolicy(AsyncFileWriter::SyncPolicy::Periodic);
     m_pSerialPortDataReceiveWidget = new SerialPortDataReceiveWidget(m_pContentPanel);
     m_pSerialPortDataSendWidget = new SerialPortDataSendWidget(m_pContentPanel);
     // 设置发送容器固定高度（重要！）
@@ -122,21 +133,120 @@ void SerialPortConfigTab::connectSignals()
                   &SerialPortConfigTab::onReadySaveFile);
     this->connect(this, &SerialPortConfigTab::displaySavePathRequested, m_pSerialPortRealTimeSaveWidget,
                   &SerialPortRealTimeSaveWidget::onDisplaySavePath);
-    this->connect(PacketProcessor::getInstance(), &PacketProcessor::serialPortReceiveDataChanged,
+    // 直接在数据处理线程中入队，写文件由独立线程批量完成，不经过界面线程
+    this->connect(PacketProcessor::getInstance(), &PacketProcessor::serialPortReceiveDataChanged, this,
                   [this](const QByteArray& data)
                   {
-                      Qt::CheckState state = m_pSerialPortReceiveSettingsWidget->getSaveToFileCheckBox()->checkState();
-                      if (state == Qt::Checked && m_pSaveFile)
+                      if (!m_pSaveWriter->isOpen()) return;
+                      // 如果数据不以换行符结尾，则添加换行符
+                      if (data.endsWith('\n'))
                       {
-                          QString dataStr = QString::fromUtf8(data);
-                          // 如果数据不以换行符结尾，则添加换行符
-                          if (!dataStr.endsWith('\n'))
-                          {
-                              dataStr.append('\n');
-                          }
-                          QTextStream out(m_pSaveFile);
-                          out << dataStr;
-                          m_pSaveFile->flush();
+                          m_pSaveWriter->write(data);
+                          return;
                       }
-                  });
+                      QByteArray line;
+                      line.reserve(data.size() + 1);
+                      line.append(data).append('\n');
+                      m_pSaveWriter->write(line);
+                  }, Qt::DirectConnection);
+    // 原始字节捕获：接收数据在处理线程中直接编码入队，发送数据在串口写出后入队
+    this->connect(PacketProcessor::getInstance(), &PacketProcessor::serialPortRawDataReceived, this,
+                  [this](const DataPacket& packet)
+                  {
+                      if (!m_pRawCaptureWriter->isOpen()) return;
+                      m_pRawCaptureWriter->write(RawCapture::encodeRecord(RawCapture::Direction::Receive,
+                                                                          packet.timestamp, packet.sourceInfo,
+                                                                          packet.data));
+                  }, Qt::DirectConnection);
+    this->connect(SerialPortManager::getInstance(), &SerialPortManager::serialPortDataSent, this,
+                  [this](const QByteArray& data)
+                  {
+                      if (!m_pRawCaptureWriter->isOpen()) return;
+                      m_pRawCaptureWriter->write(RawCapture::encodeRecord(RawCapture::Direction::Send,
+                                                                          QDateTime::currentMSecsSinceEpoch() * 1000,
+                                                                          SerialPortManager::getInstance()->
+                                                                          getSerialPort()->portName(), data));
+                  }, Qt::DirectConnection);
+    // 写线程中打开新分段时在界面上显示当前分段路径
+    this->connect(m_pSaveWriter, &AsyncFileWriter::segmentOpened, this, [this](const QString& path)
+    {
+        if (!m_pSaveWriter->isOpen()) return;
+        m_textSavePath = path;
+        this->updateSavePathDisplay();
+    }, Qt::QueuedConnection);
+    this->connect(m_pRawCaptureWriter, &AsyncFileWriter::segmentOpened, this, [this](const QString& path)
+    {
+        if (!m_pRawCaptureWriter->isOpen()) return;
+        m_rawSavePath = path;
+        this->updateSavePathDisplay();
+    }, Qt::QueuedConnection);
+    for (AsyncFileWriter* writer : {m_pSaveWriter, m_pRawCaptureWriter})
+    {
+        this->connect(writer, &AsyncFileWriter::errorOccurred, this, [this](const QString& message)
+        {
+            CMessageBox::showToast(this, message);
+        }, Qt::QueuedConnection);
+    }
+}
+
+bool SerialPortConfigTab::openSaveWriters(const QString& fileName)
+{
+    using SaveContent = RealTimeSaveSettingsDialog::SaveContent;
+    m_textSavePath.clear();
+    m_rawSavePath.clear();
+    if (m_saveContent != SaveContent::Raw)
+    {
+        // 接收区已有的数据由写线程从记录快照中分块写出，不在界面线程中拼接整个文档
+        auto reader = std::make_shared<ReceiveRecordStore::Reader>(ReceiveRecordStore::getInstance()->snapshot(),
+                                                                   ReceiveRecordFilter());
+        m_pSaveWriter->setPrologueSource([reader]
+        {
+            return reader->readChunk(PROLOGUE_CHUNK_SIZE);
+        });
+        if (!m_pSaveWriter->open(fileName))
+        {
+            m_pSaveWriter->setPrologueSource(nullptr);
+            return false;
+        }
+    }
+    if (m_saveContent == SaveContent::Text) return true;
+    // 原始字节保存到同目录下的同名.sdtr文件
+    const QFileInfo fileInfo(fileName);
+    const QString rawFileName = fileInfo.absoluteDir().filePath(
+        QString("%1.%2").arg(fileInfo.completeBaseName(), RawCapture::FILE_SUFFIX));
+    this->recoverRawCaptures(fileInfo);
+    // 同名捕获文件已存在时接着写入，不清空之前采集的数据
+    if (m_pRawCaptureWriter->open(rawFileName, QIODevice::WriteOnly | QIODevice::Append)) return true;
+    m_pSaveWriter->close();
+    return false;
+}
+
+void SerialPortConfigTab::recoverRawCaptures(const QFileInfo& fileInfo)
+{
+    // 上次采集异常退出时，分段文件末尾留有预分配的空白区域且带脏标记，开始新的保存前统一恢复
+    const QDir dir = fileInfo.absoluteDir();
+    const QStringList nameFilters{QString("%1*.%2").arg(fileInfo.completeBaseName(), RawCapture::FILE_SUFFIX)};
+    for (const QString& name : dir.entryList(nameFilters, QDir::Files))
+    {
+        const QString path = dir.filePath(name);
+        // 非映射方式写入的文件不需要恢复
+        if (!MappedCaptureWriter::isMappedCapture(path)) continue;
+        QString errorString;
+        if (!MappedCaptureWriter::recover(path, errorString))
+            qWarning() << "Failed to recover raw capture" << path << ":" << errorString;
+    }
+}
+
+void SerialPortConfigTab::closeSaveWriters()
+{
+    m_pSaveWriter->close();
+    m_pRawCaptureWriter->close();
+}
+
+void SerialPortConfigTab::updateSavePathDisplay()
+{
+    QStringList paths;
+    if (!m_rawSavePath.isEmpty()) paths.append(m_rawSavePath);
+    if (!m_textSavePath.isEmpty()) paths.append(m_textSavePath);
+    if (!paths.isEmpty()) emit displaySavePathRequested(paths.join('\n'));
 }
@@ -34,21 +34,40 @@ QPlainTextEdit* SerialPortDataReceiveWidget::getReceiveTextEdit()
 void SerialPortDataReceiveWidget::onClearReceiveData()
 {
     pReceiveTextEdit->clear();
+    ReceiveRecordStore::getInstance()->clear();
 }
 
 void SerialPortDataReceiveWidget::onSaveReceiveData()
 {
+    if (m_pExporter)
+    {
+        CMessageBox::showToast(this, "正在保存数据，请稍候");
+        return;
+    }
     QString fileName = QFileDialog::getSaveFileName(this,
                                                     "保存数据",
                                                     QDir::homePath(),
                                                     "文本文件 (*.txt)");
     if (fileName.isEmpty()) return;
-    QFile file(fileName);
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) return;
-    QTextStream out(&file);
-    out << getReceiveTextEdit()->toPlainText();
-    file.close();
-    CMessageBox::showToast(this, "数据已保存至" + fileName);
+    const ReceiveRecordStore::Snapshot snapshot = ReceiveRecordStore::getInstance()->snapshot();
+    ReceiveDataSaveDialog* dialog = new ReceiveDataSaveDialog(this);
+    dialog->setTimeRange(snapshot.firstTimestamp, snapshot.lastTimestamp);
+    const bool accepted = dialog->exec() == QDialog::Accepted;
+    const ReceiveRecordFilter filter = dialog->getFilter();
+    QTimer::singleShot(0, dialog, &ReceiveDataSaveDialog::deleteLater);
+    if (!accepted) return;
+    // 在线程池中按块写出记录快照，不在界面线程中生成整个文档的文本
+    m_pExporter = new ReceiveDataExporter(fileName, filter);
+    m_pProgressDialog = new QProgressDialog("正在保存接收数据...", "取消", 0, 100, this);
+    m_pProgressDialog->setWindowModality(Qt::WindowModal);
+    m_pProgressDialog->setMinimumDuration(500);
+    m_pProgressDialog->setAutoClose(false);
+    m_pProgressDialog->setAutoReset(false);
+    this->connect(m_pProgressDialog, &QProgressDialog::canceled, m_pExporter, &ReceiveDataExporter::cancel,
+                  Qt::DirectConnection);
+    this->connect(m_pExporter, &ReceiveDataExporter::progressChanged, m_pProgressDialog, &QProgressDialog::setValue);
+    this->connect(m_pExporter, &ReceiveDataExporter::finished, this, &SerialPortDataReceiveWidget::onSaveFinished);
+    ThreadPoolManager::addTask(&ReceiveDataExporter::run, m_pExporter);
 }
 
 bool SerialPortDataReceiveWidget::eventFilter(QObject* watched, QEvent* event)
@@ -83,25 +102,12 @@ bool SerialPortDataReceiveWidget::eventFilter(QObject* watched, QEvent* event)
 // private slots
 void SerialPortDataReceiveWidget::onDisplayReceiveData(const QString& data)
 {
-    // 暂停重绘以提高性能
-    m_pReceiveTextEdit->setUpdatesEnabled(false);
-    // 获取当前滚动条位置
-    QScrollBar* vScroll = m_pReceiveTextEdit->verticalScrollBar();
-    bool atBottom = vScroll->value() == vScroll->maximum();
-    QString receivedString = data.trimmed();
-    m_pReceiveTextEdit->appendPlainText(receivedString);
-    // 恢复自动滚动（如果启用且之前已在底部）
-    if (atBottom)
-    {
-        vScroll->setValue(vScroll->maximum());
-    }
-    // 恢复重绘
-    m_pReceiveTextEdit->setUpdatesEnabled(true);
+    this->appendLine(data, false);
 }
 
 void SerialPortDataReceiveWidget::onDisplaySentDataWithHighlight(const QString& data)
 {
-    this->onDisplayReceiveData(data);
+    this->appendLine(data, true);
     // 获取最后一行（刚刚添加的数据行）
     QTextBlock lastBlock = m_pReceiveTextEdit->document()->lastBlock();
     // 创建文本光标并选中该块
@@ -124,7 +130,44 @@ void SerialPortDataReceiveWidget::onDisplaySentDataWithHighlight(const QString&
     }
 }
 
+void SerialPortDataReceiveWidget::onSaveFinished(bool success, const QString& message)
+{
+    Q_UNUSED(success);
+    if (m_pProgressDialog)
+    {
+        m_pProgressDialog->close();
+        m_pProgressDialog->deleteLater();
+        m_pProgressDialog = nullptr;
+    }
+    if (m_pExporter)
+    {
+        m_pExporter->deleteLater();
+        m_pExporter = nullptr;
+    }
+    CMessageBox::showToast(this, message);
+}
+
 // 私有方法
+void SerialPortDataReceiveWidget::appendLine(const QString& data, bool isSent)
+{
+    // 暂停重绘以提高性能
+    m_pReceiveTextEdit->setUpdatesEnabled(false);
+    // 获取当前滚动条位置
+    QScrollBar* vScroll = m_pReceiveTextEdit->verticalScrollBar();
+    bool atBottom = vScroll->value() == vScroll->maximum();
+    QString receivedString = data.trimmed();
+    m_pReceiveTextEdit->appendPlainText(receivedString);
+    // 数据存储是完整的接收记录，保存时从存储中流式读取；显示区超出行数上限后丢弃最早的行
+    ReceiveRecordStore::getInstance()->append(receivedString, isSent);
+    // 恢复自动滚动（如果启用且之前已在底部）
+    if (atBottom)
+    {
+        vScroll->setValue(vScroll->maximum());
+    }
+    // 恢复重绘
+    m_pReceiveTextEdit->setUpdatesEnabled(true);
+}
+
 void SerialPortDataReceiveWidget::setUI()
 {
     this->setAttribute(Qt::WA_StyledBackground);
@@ -141,6 +184,8 @@ void SerialPortDataReceiveWidget::createComponents()
     m_pReceiveTextEdit->setReadOnly(true); // 设置为只读
     m_pReceiveTextEdit->setUndoRedoEnabled(false); // 禁用撤销/重做
     m_pReceiveTextEdit->setLineWrapMode(QPlainTextEdit::WidgetWidth); // 设置自动换行模式为按窗口宽度换行
+    // 完整记录保存在ReceiveRecordStore中，显示区只保留最近的行，不再另存一份整个会话的文本
+    m_pReceiveTextEdit->setMaximumBlockCount(MAX_DISPLAY_LINES);
     pReceiveTextEdit = m_pReceiveTextEdit;
     // 替换系统等宽字体调用
     QFont fixedFont("Consolas", 10);
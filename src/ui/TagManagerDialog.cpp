@@ -100,6 +100,77 @@ void TagManagerDialog::onDeleteButtonClicked()
     // 如果用户点击“取消”，则什么也不做
 }
 
+void TagManagerDialog::onImportButtonClicked()
+{
+    if (m_pTagFile)
+    {
+        CMessageBox::showToast(this, "正在处理点位表，请稍候");
+        return;
+    }
+    const QString fileName = QFileDialog::getOpenFileName(this, "导入点位表", QString(),
+                                                          "点位表(*.csv *.json);;CSV文件(*.csv);;JSON文件(*.json)");
+    if (fileName.isEmpty()) return;
+    // 解析和校验在线程池中进行，上千个点位也不会卡住界面
+    m_pTagFile = new ModbusTagFile(fileName, ModbusTagFile::formatFromFileName(fileName));
+    this->connect(m_pTagFile, &ModbusTagFile::loaded, this, &TagManagerDialog::onTagsLoaded);
+    // 任务结束后自行释放，对话框先关闭也不会泄漏
+    this->connect(m_pTagFile, &ModbusTagFile::loaded, m_pTagFile, &QObject::deleteLater);
+    this->setFileButtonsEnabled(false);
+    ThreadPoolManager::addTask(&ModbusTagFile::load, m_pTagFile);
+}
+
+void TagManagerDialog::onExportButtonClicked()
+{
+    if (m_pTagFile)
+    {
+        CMessageBox::showToast(this, "正在处理点位表，请稍候");
+        return;
+    }
+    if (m_tags.isEmpty())
+    {
+        CMessageBox::showToast(this, "没有可导出的点位。");
+        return;
+    }
+    QString selectedFilter;
+    QString fileName = QFileDialog::getSaveFileName(this, "导出点位表", QDir::homePath(),
+                                                    "CSV文件(*.csv);;JSON文件(*.json)", &selectedFilter);
+    if (fileName.isEmpty()) return;
+    if (QFileInfo(fileName).suffix().isEmpty()) fileName += selectedFilter.contains("*.json") ? ".json" : ".csv";
+    m_pTagFile = new ModbusTagFile(fileName, ModbusTagFile::formatFromFileName(fileName));
+    this->connect(m_pTagFile, &ModbusTagFile::saved, this, &TagManagerDialog::onTagsSaved);
+    this->connect(m_pTagFile, &ModbusTagFile::saved, m_pTagFile, &QObject::deleteLater);
+    this->setFileButtonsEnabled(false);
+    // 传入点位表的副本，导出期间对话框中的修改不影响正在写入的数据
+    ThreadPoolManager::addTask(&ModbusTagFile::save, m_pTagFile, QList<ModbusTag>(m_tags));
+}
+
+void TagManagerDialog::onTagsLoaded(bool success, const QString& message, const QList<ModbusTag>& tags)
+{
+    this->releaseTagFile();
+    if (!success)
+    {
+        CMessageBox::showToast(this, message);
+        return;
+    }
+    if (!m_tags.isEmpty())
+    {
+        QString question = QString("导入的 %1 个点位将替换现有的 %2 个点位，是否继续？")
+                           .arg(tags.size()).arg(m_tags.size());
+        if (!CMessageBox::confirm(this, "导入点位表", question)) return;
+    }
+    m_tags = tags;
+    this->populateList();
+    m_pListWidget->setCurrentItem(nullptr);
+    CMessageBox::showToast(this, message);
+}
+
+void TagManagerDialog::onTagsSaved(bool success, const QString& message)
+{
+    Q_UNUSED(success);
+    this->releaseTagFile();
+    CMessageBox::showToast(this, message);
+}
+
 void TagManagerDialog::setUI()
 {
     this->createComponents();
@@ -120,6 +191,7 @@ void TagManagerDialog::createComponents()
         | Qt::WindowMaximizeButtonHint);
 
     m_pListWidget = new QListWidget(this);
+    m_pListWidget->setUniformItemSizes(true); // 上千个点位时不必逐项测量行高
     // 优化QListWidget的聚焦行为
     m_pListWidget->setFocusPolicy(Qt::ClickFocus);
     m_pListWidget->setAttribute(Qt::WA_MacShowFocusRect, false); // 在Mac上隐藏聚焦矩形
@@ -128,6 +200,9 @@ void TagManagerDialog::createComponents()
     m_pEditButton = new QPushButton("编辑", this);
     m_pDeleteButton = new QPushButton("删除", this);
     m_pDeleteButton->setObjectName("m_pDeleteButton");
+    m_pImportButton = new QPushButton("导入", this);
+    m_pImportButton->setToolTip("从CSV或JSON文件导入点位表，字段为 " + ModbusTagFile::getColumns().join(','));
+    m_pExportButton = new QPushButton("导出", this);
     m_pSaveButton = new QPushButton("保存", this);
 }
 
@@ -136,6 +211,8 @@ void TagManagerDialog::createLayout()
     m_pMainLayout = new QVBoxLayout(this);
     m_pMainLayout->addWidget(m_pListWidget);
     QHBoxLayout* pButtonLayout = new QHBoxLayout();
+    pButtonLayout->addWidget(m_pImportButton);
+    pButtonLayout->addWidget(m_pExportButton);
     pButtonLayout->addStretch();
     pButtonLayout->addWidget(m_pAddButton);
     pButtonLayout->addWidget(m_pEditButton);
@@ -152,10 +229,13 @@ void TagManagerDialog::connectSignals()
     this->connect(m_pListWidget, &QListWidget::itemDoubleClicked, this, &TagManagerDialog::onEditButtonClicked);
     this->connect(m_pDeleteButton, &QPushButton::clicked, this, &TagManagerDialog::onDeleteButtonClicked);
     this->connect(m_pSaveButton, &QPushButton::clicked, this, &TagManagerDialog::accept);
+    this->connect(m_pImportButton, &QPushButton::clicked, this, &TagManagerDialog::onImportButtonClicked);
+    this->connect(m_pExportButton, &QPushButton::clicked, this, &TagManagerDialog::onExportButtonClicked);
 }
 
 void TagManagerDialog::populateList()
 {
+    m_pListWidget->setUpdatesEnabled(false); // 批量添加期间不重绘
     m_pListWidget->clear(); // 刷新前总是先清空列表
 
     for (int i = 0; i < m_tags.size(); ++i)
@@ -178,6 +258,7 @@ void TagManagerDialog::populateList()
 
         m_pListWidget->addItem(item);
     }
+    m_pListWidget->setUpdatesEnabled(true);
 }
 
 QString TagManagerDialog::dataTypeToString(ModbusTag::DataType type)
@@ -192,3 +273,16 @@ QString TagManagerDialog::dataTypeToString(ModbusTag::DataType type)
     default: return "Unknown";
     }
 }
+
+void TagManagerDialog::setFileButtonsEnabled(bool enabled)
+{
+    m_pImportButton->setEnabled(enabled);
+    m_pExportButton->setEnabled(enabled);
+}
+
+void TagManagerDialog::releaseTagFile()
+{
+    // 对象由deleteLater释放，这里只清除引用
+    m_pTagFile = nullptr;
+    this->setFileButtonsEnabled(true);
+}
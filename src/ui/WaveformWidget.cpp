@@ -2,272 +2,292 @@
   ******************************************************************************
   * @file           : WaveformWidget.cpp
   * @author         : wangxiangyu
-  * @brief          : None
+  * @brief          : 基于QPainter的原生波形显示控件实现
   * @attention      : None
   * @date           : 2025/7/31
   ******************************************************************************
   */
 
 #include "ui/WaveformWidget.h"
+#include <algorithm>
+#include <limits>
 
 // 构造函数和析构函数
 WaveformWidget::WaveformWidget(QWidget* parent)
-    : QWidget(parent)
+    : QWidget(parent), m_pStore(WaveformSampleStore::getInstance())
 {
     this->setUI();
 }
 
 // 事件处理方法
-void WaveformWidget::resizeEvent(QResizeEvent* event)
+void WaveformWidget::paintEvent(QPaintEvent* event)
 {
-    QWidget::resizeEvent(event);
-
-    if (!m_pageLoaded) return;
-
-    m_isResizing = true;
+    Q_UNUSED(event);
+    QPainter painter(this);
+    painter.fillRect(this->rect(), Qt::white);
+    this->drawTitleAndLegend(painter);
+    this->drawAxes(painter);
+    this->drawSeries(painter);
+    this->drawHoverInfo(painter);
+}
 
-    // 暂停数据更新以提升resize性能
-    if (m_updateTimer->isActive()) m_updateTimer->stop();
+void WaveformWidget::wheelEvent(QWheelEvent* event)
+{
+    QRect plotRect = this->calculatePlotRect();
+    if (!plotRect.contains(event->position().toPoint()))
+    {
+        QWidget::wheelEvent(event);
+        return;
+    }
+    // 以鼠标所在时间点为中心缩放X轴
+    double anchor = this->pixelToX(event->position().x());
+    double factor = event->angleDelta().y() > 0 ? 0.8 : 1.25;
+    double newMin = anchor - (anchor - m_viewXMin) * factor;
+    double newMax = anchor + (m_viewXMax - anchor) * factor;
+    this->setViewRange(newMin, newMax);
+    event->accept();
+}
 
-    // 延迟恢复数据更新
-    QTimer::singleShot(200, this, [this]()
+void WaveformWidget::mousePressEvent(QMouseEvent* event)
+{
+    if (event->button() != Qt::LeftButton)
     {
-        m_isResizing = false;
-        // 执行缓存的JS命令
-        this->flushPendingJSCommands();
-        // 强制检查并安排更新，确保图表恢复更新
+        QWidget::mousePressEvent(event);
+        return;
+    }
+    // 点击图例切换通道显示
+    for (const auto& hit : m_legendHitRects)
+    {
+        if (!hit.first.contains(event->pos())) continue;
+        if (hit.second >= 0 && hit.second < m_series.size())
         {
-            QMutexLocker locker(&m_dataMutex);
-            if (!m_pendingData.isEmpty())
-            {
-                m_updateScheduled = true;
-                m_updateTimer->start(16);
-            }
-            else
-            {
-                if (m_updateTimer->isActive()) m_updateTimer->stop();
-            }
+            m_series[hit.second].visible = !m_series[hit.second].visible;
+            m_dirty = true;
         }
-    });
+        return;
+    }
+    if (this->calculatePlotRect().contains(event->pos()))
+    {
+        m_isPanning = true;
+        m_lastMousePos = event->pos();
+        this->setCursor(Qt::ClosedHandCursor);
+    }
+}
 
-    // 使用防抖处理resize
-    if (m_renderTimer)
+void WaveformWidget::mouseMoveEvent(QMouseEvent* event)
+{
+    m_hoverPos = event->pos();
+    m_isHovering = this->calculatePlotRect().contains(m_hoverPos);
+    if (m_isPanning)
     {
-        m_renderTimer->start(100); // 100ms防抖
-        return;
+        // 拖动平移X轴
+        QRect plotRect = this->calculatePlotRect();
+        double dx = (event->pos().x() - m_lastMousePos.x()) * (m_viewXMax - m_viewXMin) / qMax(1, plotRect.width());
+        m_lastMousePos = event->pos();
+        double width = m_viewXMax - m_viewXMin;
+        double newMin = std::clamp(m_viewXMin - dx, m_fullXMin, m_fullXMax - width);
+        this->setViewRange(newMin, newMin + width);
     }
+    m_dirty = true;
+}
 
-    m_renderTimer = new QTimer(this);
-    m_renderTimer->setSingleShot(true);
-    this->connect(m_renderTimer, &QTimer::timeout, this, [this]()
+void WaveformWidget::mouseReleaseEvent(QMouseEvent* event)
+{
+    if (event->button() == Qt::LeftButton && m_isPanning)
     {
-        if (m_pageLoaded) this->executeJS("if (typeof handleResize === 'function') handleResize();");
-    });
+        m_isPanning = false;
+        this->unsetCursor();
+    }
+    QWidget::mouseReleaseEvent(event);
+}
 
-    m_renderTimer->start(100); // 100ms防抖
+void WaveformWidget::mouseDoubleClickEvent(QMouseEvent* event)
+{
+    // 双击还原为自动跟随视图
+    if (this->calculatePlotRect().contains(event->pos())) this->resetView();
 }
 
-// private slots
-void WaveformWidget::onPageLoadFinished(bool status)
+void WaveformWidget::leaveEvent(QEvent* event)
 {
-    if (!status) return;
-    m_pageLoaded = true;
+    m_isHovering = false;
+    m_dirty = true;
+    QWidget::leaveEvent(event);
 }
 
+// private slots
 void WaveformWidget::onChannelAdded(const QString& name, const QString& color)
 {
-    if (!m_pageLoaded) return;
-    QString jsCode = QString("addSeries('%1', '%2')").arg(name, StyleLoader::getColorHex(color));
-    this->executeJS(jsCode);
+    this->addSeries(name, QColor(StyleLoader::getColorHex(color)), false);
 }
 
 void WaveformWidget::onChannelRemoved(const QString& name)
 {
-    if (!m_pageLoaded) return;
-    QString jsCode = QString("removeSeries('%1')").arg(name);
-    this->executeJS(jsCode);
+    for (int i = 0; i < m_series.size(); ++i)
+    {
+        if (m_series[i].name != name) continue;
+        m_series.removeAt(i);
+        break;
+    }
+    m_pStore->removeChannel(name);
+    if (m_series.isEmpty()) this->onChannelsDataAllCleared();
+    m_dirty = true;
 }
 
-void WaveformWidget::onWaveformDataAdded(const QString& channelName, const QVariant& data)
+void WaveformWidget::onWaveformBlockReady(const QString& channelName, const QVector<double>& timestamps,
+                                          const QVector<double>& values)
 {
-    if (!m_pageLoaded) return;
-    if (!data.canConvert<QVariantList>()) return;
-    QVariantList pointList = data.toList();
-    if (pointList.size() < 2) return;
-    // 使用互斥锁保护数据访问
-    {
-        QMutexLocker locker(&m_dataMutex);
-        // 将数据添加到待处理队列
-        DataPoint point;
-        point.channelName = channelName;
-        point.timestamp = pointList[0].toDouble();
-        point.value = pointList[1].toDouble();
-        m_pendingData.enqueue(point);
-        if (m_pendingData.size() >= MAX_QUEUE_SIZE) m_pendingData.dequeue();
-        // 如果没有计划更新，则安排一次更新
-        if (m_updateScheduled) return;
-        m_updateScheduled = true;
-        // 只有不在 resize 过程中才启动定时器
-        if (!m_isResizing) m_updateTimer->start(16); // 约60FPS
-        // 如果在 resize 过程中，数据会被保留，等待 resize 结束后处理
-    }
+    const qsizetype count = qMin(timestamps.size(), values.size());
+    if (count == 0) return;
+    m_pStore->appendSamples(channelName, timestamps.constData(), values.constData(), count);
+    auto [minIt, maxIt] = std::minmax_element(values.cbegin(), values.cbegin() + count);
+    m_dataMaxAbs = qMax(m_dataMaxAbs, qMax(std::abs(*minIt), std::abs(*maxIt)));
+    m_dataMaxTime = qMax(m_dataMaxTime, timestamps[count - 1]);
+    m_dirty = true;
 }
 
-void WaveformWidget::onProcessPendingData()
+void WaveformWidget::onRenderTimerTimeout()
 {
-    // 在resize过程中暂时不更新图表
-    if (m_isResizing)
-    {
-        // 只有在有待处理数据时才重新调度
-        QMutexLocker locker(&m_dataMutex);
-        if (!m_pendingData.isEmpty() && !m_updateTimer->isActive()) m_updateTimer->start(50);
-        return;
-    }
+    if (!m_dirty) return;
+    m_dirty = false;
+    this->updateAutoRange();
+    this->update();
+}
 
-    // 批量处理队列中的数据
-    QJsonObject seriesDataObject;
+void WaveformWidget::onChannelsDataAllCleared()
+{
+    // 手动创建的通道：清空数据但保留通道；导入的通道：完全移除
+    for (int i = m_series.size() - 1; i >= 0; --i)
     {
-        QMutexLocker locker(&m_dataMutex);
-        if (!m_pageLoaded || m_pendingData.isEmpty())
-        {
-            m_updateScheduled = false;
-            if (m_updateTimer->isActive()) m_updateTimer->stop();
-            return;
-        }
-
-        // 按通道名分组处理数据
-        QHash<QString, QJsonArray> channelData;
-
-        // 批量处理，每次最多处理1000个数据点
-        const int BATCH_SIZE = 1000;
-        int processed = 0;
-
-        while (!m_pendingData.isEmpty() && processed < BATCH_SIZE)
+        if (m_series[i].imported)
         {
-            DataPoint point = m_pendingData.dequeue();
-
-            QJsonArray pointArray;
-            pointArray.append(point.timestamp);
-            pointArray.append(point.value);
-
-            channelData[point.channelName].append(pointArray);
-            processed++;
-        }
-
-        // 转换为最终的JSON对象
-        for (auto it = channelData.begin(); it != channelData.end(); ++it)
-        {
-            seriesDataObject[it.key()] = it.value();
-        }
-
-        // 如果队列还有数据，继续调度处理
-        if (!m_pendingData.isEmpty())
-        {
-            m_updateTimer->start(16);
+            m_pStore->removeChannel(m_series[i].name);
+            m_series.removeAt(i);
         }
         else
         {
-            m_updateScheduled = false;
+            m_pStore->clearChannel(m_series[i].name);
         }
     }
+    m_dataMaxAbs = 0.0;
+    m_dataMaxTime = 0.0;
+    m_fullXMin = INITIAL_X_MIN;
+    m_fullXMax = INITIAL_X_MAX;
+    this->resetView();
+}
 
-    // 发送数据到JavaScript
-    if (!seriesDataObject.isEmpty())
+void WaveformWidget::onChannelsDataImported()
+{
+    if (m_pExporter || m_pImporter)
     {
-        QJsonDocument doc(seriesDataObject);
-        QString jsonStr = QString::fromUtf8(doc.toJson(QJsonDocument::Compact));
-        QString jsCode = QString("batchAddDataPoints(%1);").arg(jsonStr);
-        this->executeJS(jsCode);
+        CMessageBox::showToast(this, "正在处理数据，请稍候");
+        return;
     }
+    QString fileName = QFileDialog::getOpenFileName(this, tr("导入数据"), QString(),
+                                                    tr("波形数据(*.json *.csv *.bin);;JSON文件(*.json);;"
+                                                        "CSV文件(*.csv);;二进制文件(*.bin)"));
+    if (fileName.isEmpty()) return;
+    // 先清除现有数据，导入在线程池中流式进行，边导入边显示概览
+    this->onChannelsDataAllCleared();
+    m_pImporter = new WaveformImporter(fileName, WaveformExporter::formatFromFileName(fileName));
+    this->createProgressDialog("正在导入波形数据...");
+    this->connect(m_pImporter, &WaveformImporter::channelFound, this, &WaveformWidget::onImportChannelFound);
+    this->connect(m_pImporter, &WaveformImporter::dataRangeChanged, this,
+                  &WaveformWidget::onImportDataRangeChanged);
+    this->connect(m_pImporter, &WaveformImporter::progressChanged, m_pProgressDialog, &QProgressDialog::setValue);
+    this->connect(m_pImporter, &WaveformImporter::finished, this, &WaveformWidget::onImportFinished);
+    ThreadPoolManager::addTask(&WaveformImporter::run, m_pImporter);
 }
 
-void WaveformWidget::onChannelsDataAllCleared()
+void WaveformWidget::onImportChannelFound(const QString& name)
 {
-    m_pendingData.clear();
-    this->executeJS("clearAllData()");
+    static const QStringList colors = {"#5470c6", "#91cc75", "#fac858", "#ee6666", "#73c0de"};
+    for (const Series& series : m_series)
+    {
+        if (series.name == name) return;
+    }
+    this->addSeries(name, QColor(colors[m_series.size() % colors.size()]), true);
 }
 
-void WaveformWidget::onChannelsDataImported()
+void WaveformWidget::onImportDataRangeChanged(double maxTime, double maxAbs)
 {
-    QString fileName = QFileDialog::getOpenFileName(this, tr("导入数据"), QString(), tr("JSON文件(*.json)"));
-    if (fileName.isEmpty()) return;
-    QFile file(fileName);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) return;
-    QTextStream in(&file);
-    in.setEncoding(QStringConverter::Utf8);
-    QString jsonData = in.readAll();
-    file.close();
-    if (jsonData.isEmpty()) return;
-    // 验证JSON格式
-    QJsonParseError parseError;
-    QJsonDocument::fromJson(jsonData.toUtf8(), &parseError);
-    if (parseError.error != QJsonParseError::NoError) return;
-    // 先设置全局变量，再调用导入函数
-    QString jsCode = QString("window.importJsonData = %1; importData(window.importJsonData);").arg(jsonData);
-    this->executeJS(jsCode);
+    m_dataMaxTime = qMax(m_dataMaxTime, maxTime);
+    m_dataMaxAbs = qMax(m_dataMaxAbs, maxAbs);
+    m_dirty = true;
+}
+
+void WaveformWidget::onImportFinished(bool success, const QString& message)
+{
+    this->closeProgressDialog();
+    if (m_pImporter)
+    {
+        m_pImporter->deleteLater();
+        m_pImporter = nullptr;
+    }
+    // 失败或取消时移除已部分导入的通道
+    if (!success) this->onChannelsDataAllCleared();
+    else this->resetView();
+    CMessageBox::showToast(this, message);
 }
 
 void WaveformWidget::onChannelsDataExported()
 {
-    QString fileName = QFileDialog::getSaveFileName(this, tr("导出数据"), QDir::homePath(), tr("JSON文件(*.json)"));
+    if (m_pExporter || m_pImporter)
+    {
+        CMessageBox::showToast(this, "正在处理数据，请稍候");
+        return;
+    }
+    QString selectedFilter;
+    QString fileName = QFileDialog::getSaveFileName(this, tr("导出数据"), QDir::homePath(),
+                                                    tr("CSV文件(*.csv);;二进制文件(*.bin);;JSON文件(*.json)"),
+                                                    &selectedFilter);
     if (fileName.isEmpty()) return;
-    if (!fileName.endsWith(".json", Qt::CaseInsensitive)) fileName += ".json";
-    m_pWebEngineView->page()->runJavaScript(QString("exportData()"), [this, fileName](const QVariant& result)
+    if (QFileInfo(fileName).suffix().isEmpty())
     {
-        QString jsonData = result.toString();
-        QFile file(fileName);
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) return;
-        QTextStream out(&file);
-        out.setEncoding(QStringConverter::Utf8);
-        out << jsonData;
-        file.close();
-    });
+        if (selectedFilter.contains("*.csv")) fileName += ".csv";
+        else if (selectedFilter.contains("*.bin")) fileName += ".bin";
+        else fileName += ".json";
+    }
+    // 导出在线程池中流式进行，界面只显示进度
+    m_pExporter = new WaveformExporter(fileName, WaveformExporter::formatFromFileName(fileName));
+    this->createProgressDialog("正在导出波形数据...");
+    this->connect(m_pExporter, &WaveformExporter::progressChanged, m_pProgressDialog, &QProgressDialog::setValue);
+    this->connect(m_pExporter, &WaveformExporter::finished, this, &WaveformWidget::onExportFinished);
+    ThreadPoolManager::addTask(&WaveformExporter::run, m_pExporter);
+}
+
+void WaveformWidget::onExportFinished(bool success, const QString& message)
+{
+    Q_UNUSED(success);
+    this->closeProgressDialog();
+    if (m_pExporter)
+    {
+        m_pExporter->deleteLater();
+        m_pExporter = nullptr;
+    }
+    CMessageBox::showToast(this, message);
 }
 
 // 私有方法
 void WaveformWidget::setUI()
 {
     this->setAttribute(Qt::WA_StyledBackground);
+    this->setAttribute(Qt::WA_OpaquePaintEvent);
+    this->setMouseTracking(true);
+    this->setMinimumSize(100, 100);
     this->createComponents();
-    this->createLayout();
     this->connectSignals();
 }
 
 void WaveformWidget::createComponents()
 {
-    // 初始化更新检查定时器
-    m_updateCheckTimer = new QTimer(this);
-    m_updateCheckTimer->setInterval(500); // 500ms检查一次
-    m_updateTimer = new QTimer(this);
-    m_updateTimer->setSingleShot(true);
-    m_pWebEngineView = std::make_unique<QWebEngineView>(this);
-    this->webEngineViewSettings();
-    // 启用透明背景
-    QPalette pal = m_pWebEngineView->palette();
-    pal.setColor(QPalette::Window, Qt::transparent);
-    m_pWebEngineView->setPalette(pal);
-    // 设置背景透明
-    m_pWebEngineView->setAttribute(Qt::WA_TranslucentBackground);
-    m_pWebEngineView->page()->setBackgroundColor(Qt::transparent);
-    // 加载html文件
-    QFile htmlFile(":/resources/web/wave.html");
-    htmlFile.open(QIODevice::ReadOnly);
-    m_pWebEngineView->setHtml(htmlFile.readAll());
-}
-
-void WaveformWidget::createLayout()
-{
-    m_pMainLayout = new QVBoxLayout(this);
-    m_pMainLayout->addWidget(m_pWebEngineView.get());
-    m_pMainLayout->setContentsMargins(0, 0, 0, 5); // 移除所有边距
+    m_pRenderTimer = new QTimer(this);
+    m_pRenderTimer->setInterval(RENDER_INTERVAL);
 }
 
 void WaveformWidget::connectSignals()
 {
-    this->connect(m_updateCheckTimer, &QTimer::timeout, this, &WaveformWidget::checkAndUpdateData);
-    this->connect(m_pWebEngineView.get(), &QWebEngineView::loadFinished, this, &WaveformWidget::onPageLoadFinished);
-    this->connect(m_updateTimer, &QTimer::timeout, this, &WaveformWidget::onProcessPendingData);
-    m_updateCheckTimer->start();
+    this->connect(m_pRenderTimer, &QTimer::timeout, this, &WaveformWidget::onRenderTimerTimeout);
+    m_pRenderTimer->start();
 
     this->connect(ChannelManager::getInstance(), &ChannelManager::channelAddedRequested, this,
                   &WaveformWidget::onChannelAdded,
@@ -276,8 +296,8 @@ void WaveformWidget::connectSignals()
                   &WaveformWidget::onChannelRemoved,
                   Qt::QueuedConnection);
     // 连接数据更新信号
-    this->connect(PacketProcessor::getInstance(), &PacketProcessor::waveformDataReady, this,
-                  &WaveformWidget::onWaveformDataAdded, Qt::QueuedConnection);
+    this->connect(PacketProcessor::getInstance(), &PacketProcessor::waveformBlockReady, this,
+                  &WaveformWidget::onWaveformBlockReady, Qt::QueuedConnection);
     this->connect(ChannelManager::getInstance(), &ChannelManager::channelsDataAllClearedRequested, this,
                   &WaveformWidget::onChannelsDataAllCleared,
                   Qt::QueuedConnection);
@@ -287,81 +307,389 @@ void WaveformWidget::connectSignals()
                   &WaveformWidget::onChannelsDataExported, Qt::QueuedConnection);
 }
 
-void WaveformWidget::webEngineViewSettings()
-{
-    // 性能优化设置
-    auto settings = m_pWebEngineView->settings();
-    // 启用JavaScript支持，确保网页能够正常执行脚本
-    settings->setAttribute(QWebEngineSettings::JavascriptEnabled, true);
-    // 启用2D画布加速渲染，提升图形绘制性能
-    settings->setAttribute(QWebEngineSettings::Accelerated2dCanvasEnabled, true);
-    // 关闭WebGL支持，不允许网页使用3D图形渲染功能
-    settings->setAttribute(QWebEngineSettings::WebGLEnabled, false);
-    // 禁用滚动动画效果，提升滚动操作的响应速度
-    settings->setAttribute(QWebEngineSettings::ScrollAnimatorEnabled, false);
-    // 禁止本地内容访问远程URL，增强安全性和性能
-    settings->setAttribute(QWebEngineSettings::LocalContentCanAccessRemoteUrls, false);
-    // 禁用空间导航功能，减少不必要的键盘导航处理
-    settings->setAttribute(QWebEngineSettings::SpatialNavigationEnabled, false);
-    // 禁用超链接审计功能，避免发送额外的网络请求
-    settings->setAttribute(QWebEngineSettings::HyperlinkAuditingEnabled, false);
-    // 禁用全屏支持功能，减少资源占用
-    settings->setAttribute(QWebEngineSettings::FullScreenSupportEnabled, false);
-    // 禁用插件支持，提升安全性和性能
-    settings->setAttribute(QWebEngineSettings::PluginsEnabled, false);
-    // 保持图像自动加载启用状态，确保图表等图片内容正常显示
-    settings->setAttribute(QWebEngineSettings::AutoLoadImages, true);
-}
-
-void WaveformWidget::executeJS(const QString& jsCode)
-{
-    if (!m_pageLoaded) return;
-
-    // 在resize过程中限制JS执行频率
-    static qint64 lastExecTime = 0;
-    qint64 currentTime = QDateTime::currentMSecsSinceEpoch();
-
-    if (m_isResizing && (currentTime - lastExecTime) < 50)
+void WaveformWidget::addSeries(const QString& name, const QColor& color, bool imported)
+{
+    for (const Series& series : m_series)
+    {
+        if (series.name == name) return;
+    }
+    Series series;
+    series.name = name;
+    series.color = color;
+    series.imported = imported;
+    m_series.append(series);
+    m_pStore->addChannel(name);
+    m_dirty = true;
+}
+
+void WaveformWidget::createProgressDialog(const QString& labelText)
+{
+    m_pProgressDialog = new QProgressDialog(labelText, "取消", 0, 100, this);
+    m_pProgressDialog->setWindowModality(Qt::WindowModal);
+    m_pProgressDialog->setMinimumDuration(500);
+    m_pProgressDialog->setAutoClose(false);
+    m_pProgressDialog->setAutoReset(false);
+    this->connect(m_pProgressDialog, &QProgressDialog::canceled, this, [this]
+    {
+        if (m_pExporter) m_pExporter->cancel();
+        if (m_pImporter) m_pImporter->cancel();
+    });
+}
+
+void WaveformWidget::closeProgressDialog()
+{
+    if (!m_pProgressDialog) return;
+    m_pProgressDialog->close();
+    m_pProgressDialog->deleteLater();
+    m_pProgressDialog = nullptr;
+}
+
+void WaveformWidget::resetView()
+{
+    m_userInteracted = false;
+    m_viewXMin = m_fullXMin;
+    m_viewXMax = m_fullXMax;
+    m_yMin = INITIAL_Y_MIN;
+    m_yMax = INITIAL_Y_MAX;
+    m_yInterval = INITIAL_Y_INTERVAL;
+    this->updateAutoRange();
+    m_dirty = true;
+}
+
+void WaveformWidget::updateAutoRange()
+{
+    // 数据超出当前X轴范围时扩展，增加20%的边距
+    if (m_dataMaxTime > m_fullXMax)
     {
-        // 在resize过程中缓存高频JS调用，而不是直接丢弃
-        m_pendingJSCommands.append(jsCode);
+        m_fullXMax = m_dataMaxTime + (m_fullXMax - m_fullXMin) * 0.2;
+    }
+    if (m_userInteracted)
+    {
+        this->updateYAxisForView();
         return;
     }
+    m_viewXMin = m_fullXMin;
+    m_viewXMax = m_fullXMax;
+    // 数据绝对值超出当前Y轴范围时，按正负各5个刻度对称扩展
+    double maxAbsValue = qMax(std::abs(m_yMin), std::abs(m_yMax));
+    if (m_dataMaxAbs > maxAbsValue)
+    {
+        m_yInterval = calculateYAxisInterval(m_dataMaxAbs);
+        m_yMax = m_yInterval * 5;
+        m_yMin = -m_yMax;
+    }
+}
 
-    lastExecTime = currentTime;
+void WaveformWidget::updateYAxisForView()
+{
+    // 根据当前可见数据更新Y轴范围
+    double minY = std::numeric_limits<double>::max();
+    double maxY = std::numeric_limits<double>::lowest();
+    bool hasVisibleData = false;
+    for (const Series& series : m_series)
+    {
+        if (!series.visible) continue;
+        double seriesMin = 0.0, seriesMax = 0.0;
+        if (!m_pStore->getValueRange(series.name, m_viewXMin, m_viewXMax, seriesMin, seriesMax)) continue;
+        minY = qMin(minY, seriesMin);
+        maxY = qMax(maxY, seriesMax);
+        hasVisibleData = true;
+    }
+    if (!hasVisibleData) return;
+    // 扩展Y轴范围10%，以便显示完整波形
+    double padding = qMax((maxY - minY) * 0.1, 1.0);
+    double newMinY = minY - padding;
+    double newMaxY = maxY + padding;
+    // 确保只显示第一和第四象限
+    if (minY >= 0 && maxY >= 0) newMinY = qMax(0.0, newMinY);
+    else if (minY < 0 && maxY < 0) newMaxY = qMin(0.0, newMaxY);
+    newMinY = std::floor(newMinY);
+    newMaxY = std::ceil(newMaxY);
+    if (newMaxY - newMinY < 1) newMaxY = newMinY + 1;
+    m_yMin = newMinY;
+    m_yMax = newMaxY;
+    m_yInterval = calculateNiceInterval(newMaxY - newMinY, 6);
+}
 
-    m_pWebEngineView->page()->runJavaScript(jsCode, [jsCode](const QVariant& result)
+void WaveformWidget::setViewRange(double xMin, double xMax)
+{
+    // 限制在完整范围内，且至少保留1ms的宽度
+    xMin = qMax(xMin, m_fullXMin);
+    xMax = qMin(xMax, m_fullXMax);
+    if (xMax - xMin < 1.0) return;
+    // 接近全局视图时，重置交互状态
+    if ((xMax - xMin) / (m_fullXMax - m_fullXMin) > 0.98)
     {
-        // qDebug() << "JavaScript执行结果:" << result;
-    });
+        this->resetView();
+        return;
+    }
+    m_userInteracted = true;
+    m_viewXMin = xMin;
+    m_viewXMax = xMax;
+    this->updateYAxisForView();
+    m_dirty = true;
+}
+
+QRect WaveformWidget::calculatePlotRect() const
+{
+    QFontMetrics metrics(this->font());
+    int labelWidth = qMax(metrics.horizontalAdvance(QString::number(m_yMin, 'g', 8)),
+                          metrics.horizontalAdvance(QString::number(m_yMax, 'g', 8)));
+    int left = labelWidth + 16;
+    int top = TITLE_HEIGHT + LEGEND_HEIGHT + 10;
+    int right = this->width() - 20;
+    int bottom = this->height() - metrics.height() * 2 - 16;
+    return QRect(QPoint(left, top), QPoint(qMax(left + 1, right), qMax(top + 1, bottom)));
+}
+
+double WaveformWidget::xToPixel(double time) const
+{
+    QRect plotRect = this->calculatePlotRect();
+    return plotRect.left() + (time - m_viewXMin) / (m_viewXMax - m_viewXMin) * plotRect.width();
+}
+
+double WaveformWidget::yToPixel(double value) const
+{
+    QRect plotRect = this->calculatePlotRect();
+    return plotRect.bottom() - (value - m_yMin) / (m_yMax - m_yMin) * plotRect.height();
+}
+
+double WaveformWidget::pixelToX(double pixel) const
+{
+    QRect plotRect = this->calculatePlotRect();
+    return m_viewXMin + (pixel - plotRect.left()) / qMax(1, plotRect.width()) * (m_viewXMax - m_viewXMin);
+}
+
+// 绘制方法
+void WaveformWidget::drawTitleAndLegend(QPainter& painter)
+{
+    QFont titleFont = this->font();
+    titleFont.setPointSize(titleFont.pointSize() + 3);
+    titleFont.setBold(true);
+    painter.setFont(titleFont);
+    painter.setPen(QColor("#333333"));
+    painter.drawText(QRect(0, 4, this->width(), TITLE_HEIGHT), Qt::AlignCenter, "iKUN示波器");
+    // 图例：居中排列，点击可切换显示
+    painter.setFont(this->font());
+    QFontMetrics metrics(this->font());
+    m_legendHitRects.clear();
+    int totalWidth = 0;
+    for (const Series& series : m_series) totalWidth += 30 + metrics.horizontalAdvance(series.name) + 12;
+    int x = qMax(0, (this->width() - totalWidth) / 2);
+    int y = TITLE_HEIGHT + 4;
+    for (int i = 0; i < m_series.size(); ++i)
+    {
+        const Series& series = m_series[i];
+        int itemWidth = 30 + metrics.horizontalAdvance(series.name) + 12;
+        QColor color = series.visible ? series.color : QColor("#cccccc");
+        painter.fillRect(QRect(x, y + LEGEND_HEIGHT / 2 - 2, 24, 4), color);
+        painter.setPen(series.visible ? QColor("#333333") : QColor("#cccccc"));
+        painter.drawText(QRect(x + 30, y, itemWidth - 30, LEGEND_HEIGHT), Qt::AlignLeft | Qt::AlignVCenter,
+                         series.name);
+        m_legendHitRects.append({QRect(x, y, itemWidth, LEGEND_HEIGHT), i});
+        x += itemWidth;
+    }
 }
 
-void WaveformWidget::checkAndUpdateData()
+void WaveformWidget::drawAxes(QPainter& painter)
 {
-    QMutexLocker locker(&m_dataMutex);
-    if (!m_isResizing && !m_updateScheduled && !m_pendingData.isEmpty() && m_pageLoaded)
+    QRect plotRect = this->calculatePlotRect();
+    QFontMetrics metrics(this->font());
+    painter.setFont(this->font());
+    // Y轴刻度与网格
+    QPen gridPen(QColor("#e0e6f1"));
+    QPen labelPen(QColor("#6e7079"));
+    if (m_yInterval > 0)
     {
-        m_updateScheduled = true;
-        m_updateTimer->start(16);
+        double firstTick = std::ceil(m_yMin / m_yInterval) * m_yInterval;
+        for (double tick = firstTick; tick <= m_yMax + m_yInterval * 1e-6; tick += m_yInterval)
+        {
+            int y = qRound(this->yToPixel(tick));
+            painter.setPen(gridPen);
+            painter.drawLine(plotRect.left(), y, plotRect.right(), y);
+            painter.setPen(labelPen);
+            QString label = std::abs(tick - std::round(tick)) < 1e-9
+                                ? QString::number(static_cast<qint64>(std::round(tick)))
+                                : QString::number(tick, 'f', 1);
+            painter.drawText(QRect(0, y - metrics.height() / 2, plotRect.left() - 6, metrics.height()),
+                             Qt::AlignRight | Qt::AlignVCenter, label);
+        }
     }
-    else if (m_pendingData.isEmpty() && m_updateTimer->isActive())
+    // X轴刻度与网格
+    double xInterval = m_userInteracted
+                           ? calculateNiceInterval(m_viewXMax - m_viewXMin, 6)
+                           : calculateXAxisInterval(m_viewXMax);
+    if (xInterval > 0)
     {
-        m_updateTimer->stop();
+        double firstTick = std::ceil(m_viewXMin / xInterval) * xInterval;
+        for (double tick = firstTick; tick <= m_viewXMax + xInterval * 1e-6; tick += xInterval)
+        {
+            int x = qRound(this->xToPixel(tick));
+            painter.setPen(gridPen);
+            painter.drawLine(x, plotRect.top(), x, plotRect.bottom());
+            painter.setPen(labelPen);
+            painter.drawText(QRect(x - 50, plotRect.bottom() + 4, 100, metrics.height()), Qt::AlignCenter,
+                             QString::number(static_cast<qint64>(std::round(tick))));
+        }
     }
+    // 坐标轴线与名称
+    painter.setPen(QColor("#6e7079"));
+    painter.drawLine(plotRect.bottomLeft(), plotRect.bottomRight());
+    painter.drawLine(plotRect.bottomLeft(), plotRect.topLeft());
+    painter.drawText(QRect(plotRect.left(), plotRect.bottom() + metrics.height() + 8, plotRect.width(),
+                           metrics.height()), Qt::AlignCenter, "时间(ms)");
 }
 
-void WaveformWidget::flushPendingJSCommands()
+void WaveformWidget::drawSeries(QPainter& painter)
 {
-    if (!m_pageLoaded || m_pendingJSCommands.isEmpty()) return;
+    QRect plotRect = this->calculatePlotRect();
+    const int columns = plotRect.width();
+    if (columns <= 0) return;
+    painter.save();
+    painter.setClipRect(plotRect.adjusted(0, 0, 1, 1));
+    painter.setRenderHint(QPainter::Antialiasing, false);
+    QVector<double> timestamps, values;
+    QPolygonF polyline;
+    QVector<QLineF> lines;
+    for (const Series& series : m_series)
+    {
+        if (!series.visible) continue;
+        painter.setPen(QPen(series.color, 1));
+        qsizetype visibleCount = m_pStore->getSampleCount(series.name, m_viewXMin, m_viewXMax);
+        if (visibleCount <= columns * LTTB_MAX_RATIO)
+        {
+            // 点数不多时直接连线，超过两倍像素列数时先做LTTB降采样
+            m_pStore->queryDisplaySamples(series.name, m_viewXMin, m_viewXMax, columns * 2, timestamps, values);
+            polyline.resize(timestamps.size());
+            for (qsizetype i = 0; i < timestamps.size(); ++i)
+                polyline[i] = QPointF(this->xToPixel(timestamps[i]), this->yToPixel(values[i]));
+            painter.drawPolyline(polyline);
+            continue;
+        }
+        // 点数远多于像素时，按像素列绘制min/max包络（由金字塔提供），并连接相邻列
+        const QVector<WaveformColumn> cells = m_pStore->queryColumns(series.name, m_viewXMin, m_viewXMax, columns);
+        lines.clear();
+        lines.reserve(cells.size() * 2);
+        const WaveformColumn* previous = nullptr;
+        double previousX = 0.0;
+        for (int column = 0; column < cells.size(); ++column)
+        {
+            const WaveformColumn& cell = cells[column];
+            if (!cell.valid) continue;
+            double x = plotRect.left() + column + 0.5;
+            if (previous)
+                lines.append(QLineF(previousX, this->yToPixel(previous->lastValue), x,
+                                    this->yToPixel(cell.firstValue)));
+            lines.append(QLineF(x, this->yToPixel(cell.minValue), x, this->yToPixel(cell.maxValue)));
+            previous = &cell;
+            previousX = x;
+        }
+        painter.drawLines(lines);
+    }
+    painter.restore();
+}
 
-    // 执行所有缓存的JS命令
-    for (const QString& jsCode : m_pendingJSCommands)
+void WaveformWidget::drawHoverInfo(QPainter& painter)
+{
+    if (!m_isHovering || m_isPanning || m_series.isEmpty()) return;
+    QRect plotRect = this->calculatePlotRect();
+    double time = this->pixelToX(m_hoverPos.x());
+    painter.setPen(QPen(QColor("#999999"), 1, Qt::DashLine));
+    painter.drawLine(m_hoverPos.x(), plotRect.top(), m_hoverPos.x(), plotRect.bottom());
+    // 组装提示文本
+    QStringList lines;
+    lines << QString("时间: %1ms").arg(time, 0, 'f', 0);
+    QVector<QColor> colors{QColor("#333333")};
+    for (const Series& series : m_series)
+    {
+        if (!series.visible) continue;
+        double sampleTime = 0.0, value = 0.0;
+        if (!m_pStore->getValueAt(series.name, time, sampleTime, value)) continue;
+        lines << QString("%1: %2").arg(series.name).arg(value, 0, 'f', 2);
+        colors << series.color;
+    }
+    QFontMetrics metrics(this->font());
+    int boxWidth = 0;
+    for (const QString& line : lines) boxWidth = qMax(boxWidth, metrics.horizontalAdvance(line));
+    boxWidth += 16;
+    int boxHeight = lines.size() * metrics.height() + 10;
+    int boxX = m_hoverPos.x() + 12;
+    if (boxX + boxWidth > plotRect.right()) boxX = m_hoverPos.x() - 12 - boxWidth;
+    int boxY = qMin(m_hoverPos.y(), plotRect.bottom() - boxHeight);
+    painter.setPen(QColor("#cccccc"));
+    painter.setBrush(QColor(255, 255, 255, 230));
+    painter.drawRoundedRect(QRect(boxX, boxY, boxWidth, boxHeight), 4, 4);
+    for (int i = 0; i < lines.size(); ++i)
+    {
+        painter.setPen(colors[i]);
+        painter.drawText(boxX + 8, boxY + 5 + metrics.ascent() + i * metrics.height(), lines[i]);
+    }
+}
+
+// 刻度计算
+double WaveformWidget::calculateXAxisInterval(double maxValue)
+{
+    // 默认刻度值为 2000, 4000, 6000, 8000, 10000
+    double interval = 2000;
+    while (interval * 5 < maxValue)
     {
-        m_pWebEngineView->page()->runJavaScript(jsCode, [](const QVariant& result)
+        qint64 current = static_cast<qint64>(interval);
+        if (current % 10000 == 0)
+        {
+            if ((current / 10000) % 5 == 0) interval *= 2; // 50000 -> 100000
+            else if ((current / 10000) % 2 == 0) interval *= 2.5; // 20000 -> 50000
+            else interval *= 2; // 10000 -> 20000
+        }
+        else if (current % 5000 == 0)
         {
-            // qDebug() << "缓存的JavaScript执行结果:" << result;
-        });
+            interval *= 2; // 5000 -> 10000
+        }
+        else
+        {
+            interval *= 2.5; // 2000 -> 5000
+        }
+    }
+    return interval;
+}
+
+double WaveformWidget::calculateYAxisInterval(double maxAbsValue)
+{
+    // 确保正负半轴各有5个刻度值，按 1, 2, 5, 10, 20, 50... 序列调整
+    double interval = 1;
+    const int targetTickCount = 5;
+    while (interval * targetTickCount < maxAbsValue)
+    {
+        qint64 current = static_cast<qint64>(interval);
+        if (current % 10 == 0)
+        {
+            if ((current / 10) % 5 == 0) interval *= 2; // 50 -> 100
+            else if ((current / 10) % 2 == 0) interval *= 2.5; // 20 -> 50
+            else interval *= 2; // 10 -> 20
+        }
+        else if (current % 5 == 0)
+        {
+            interval *= 2; // 5 -> 10
+        }
+        else if (current == 2)
+        {
+            interval = 5; // 2 -> 5
+        }
+        else
+        {
+            interval *= 2; // 1 -> 2
+        }
     }
+    return interval;
+}
 
-    m_pendingJSCommands.clear();
+double WaveformWidget::calculateNiceInterval(double range, int targetTickCount)
+{
+    if (range <= 0 || targetTickCount <= 0) return 0;
+    double rawInterval = range / targetTickCount;
+    double magnitude = std::pow(10.0, std::floor(std::log10(rawInterval)));
+    double normalized = rawInterval / magnitude;
+    if (normalized < 1.5) return magnitude;
+    if (normalized < 3) return 2 * magnitude;
+    if (normalized < 7) return 5 * magnitude;
+    return 10 * magnitude;
 }
@@ -0,0 +1,412 @@
+/**
+  ******************************************************************************
+  * @file           : AsyncFileWriter.cpp
+  * @author         : wangxiangyu
+  * @brief          : 异步批量文件写入线程实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/AsyncFileWriter.h"
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// 构造函数和析构函数
+AsyncFileWriter::AsyncFileWriter(QObject* parent) : QThread(parent)
+{
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    this->close();
+}
+
+bool AsyncFileWriter::open(const QString& fileName, QIODevice::OpenMode mode)
+{
+    this->close();
+    m_baseFileName = fileName;
+    // 写线程自行合并数据，不再需要QFile内部缓冲
+    m_openMode = mode | QIODevice::Unbuffered;
+    m_segmentIndex = 0;
+    m_pSegments = std::make_shared<SegmentRegistry>();
+    m_pSegments->maxTotalBytes = m_rotationConfig.isEnabled() ? m_rotationConfig.maxTotalBytes : 0;
+    if (!this->openSegment()) return false;
+    {
+        QMutexLocker locker(&m_mutex);
+        m_quit = false;
+        m_pendingBytes = 0;
+        m_queue.clear();
+    }
+    m_bytesWritten.store(0);
+    m_isOpen.store(true);
+    m_syncTimer.start();
+    if (m_storageMode == StorageMode::Stream) this->start();
+    return true;
+}
+
+void AsyncFileWriter::close()
+{
+    if (!m_isOpen.exchange(false)) return;
+    if (m_storageMode == StorageMode::Mapped)
+    {
+        QMutexLocker locker(&m_mutex);
+        this->closeSegment();
+        return;
+    }
+    {
+        QMutexLocker locker(&m_mutex);
+        m_quit = true;
+        m_dataAvailable.wakeAll();
+        m_spaceAvailable.wakeAll();
+    }
+    this->wait();
+    this->closeSegment();
+}
+
+bool AsyncFileWriter::write(const QByteArray& data)
+{
+    if (data.isEmpty()) return true;
+    QMutexLocker locker(&m_mutex);
+    if (m_storageMode == StorageMode::Mapped) return m_isOpen.load() && this->writeMapped(data);
+    // 队列已满时等待写线程腾出空间，保证不丢数据
+    while (m_isOpen.load() && !m_quit && m_pendingBytes > 0 && m_pendingBytes + data.size() > MAX_QUEUE_BYTES)
+        m_spaceAvailable.wait(&m_mutex);
+    if (!m_isOpen.load() || m_quit) return false;
+    const bool wasEmpty = m_queue.isEmpty();
+    if (wasEmpty) m_batchTimer.start();
+    m_queue.enqueue(data);
+    m_pendingBytes += data.size();
+    // 只在开始新批次或达到提交阈值时唤醒，避免每包一次线程切换
+    if (wasEmpty || m_pendingBytes >= COMMIT_SIZE) m_dataAvailable.wakeOne();
+    return true;
+}
+
+bool AsyncFileWriter::isOpen() const
+{
+    return m_isOpen.load();
+}
+
+QString AsyncFileWriter::getFileName() const
+{
+    return m_file.fileName();
+}
+
+qint64 AsyncFileWriter::getBytesWritten() const
+{
+    return m_bytesWritten.load();
+}
+
+void AsyncFileWriter::setSyncPolicy(SyncPolicy policy)
+{
+    m_syncPolicy.store(policy);
+}
+
+AsyncFileWriter::SyncPolicy AsyncFileWriter::getSyncPolicy() const
+{
+    return m_syncPolicy.load();
+}
+
+void AsyncFileWriter::setStorageMode(StorageMode mode)
+{
+    m_storageMode = mode;
+}
+
+void AsyncFileWriter::setRotationConfig(const LogRotationConfig& config)
+{
+    m_rotationConfig = config;
+}
+
+LogRotationConfig AsyncFileWriter::getRotationConfig() const
+{
+    return m_rotationConfig;
+}
+
+void AsyncFileWriter::setSegmentHeader(const QByteArray& header)
+{
+    m_segmentHeader = header;
+}
+
+void AsyncFileWriter::setPrologueSource(std::function<QByteArray()> source)
+{
+    m_prologueSource = std::move(source);
+}
+
+void AsyncFileWriter::run()
+{
+    QQueue<QByteArray> batch;
+    bool ok = this->writePrologue();
+    while (true)
+    {
+        m_mutex.lock();
+        // 等待批次达到大小阈值或时间阈值
+        while (!m_quit && m_pendingBytes < COMMIT_SIZE)
+        {
+            if (m_queue.isEmpty())
+            {
+                m_dataAvailable.wait(&m_mutex);
+                continue;
+            }
+            const qint64 remaining = COMMIT_INTERVAL - m_batchTimer.elapsed();
+            if (remaining <= 0) break;
+            m_dataAvailable.wait(&m_mutex, static_cast<unsigned long>(remaining));
+        }
+        const bool quit = m_quit;
+        const qint64 batchBytes = m_pendingBytes;
+        batch.swap(m_queue);
+        m_pendingBytes = 0;
+        m_spaceAvailable.wakeAll();
+        m_mutex.unlock();
+        if (ok && !batch.isEmpty())
+        {
+            if (this->shouldRotate(batchBytes))
+            {
+                this->closeSegment();
+                ok = this->openSegment();
+            }
+            if (ok) ok = this->commit(batch, batchBytes);
+        }
+        batch.clear();
+        if (quit) break;
+    }
+    if (ok && m_file.isOpen() && m_syncPolicy.load() != SyncPolicy::None) syncToDisk(m_file);
+}
+
+// SegmentRegistry
+void AsyncFileWriter::SegmentRegistry::updateSegment(const QString& path, const QString& newPath, qint64 size,
+                                                     bool busy)
+{
+    QMutexLocker locker(&mutex);
+    for (SegmentRecord& record : segments)
+    {
+        if (record.path != path) continue;
+        record.path = newPath;
+        record.size = size;
+        record.busy = busy;
+        break;
+    }
+    this->enforceLimit();
+}
+
+void AsyncFileWriter::SegmentRegistry::enforceLimit()
+{
+    if (maxTotalBytes <= 0) return;
+    qint64 totalBytes = 0;
+    for (const SegmentRecord& record : segments) totalBytes += record.size;
+    // 从最早的分段开始删除，跳过正在写入或压缩的分段
+    for (qsizetype i = 0; i < segments.size() && totalBytes > maxTotalBytes;)
+    {
+        if (segments[i].busy)
+        {
+            ++i;
+            continue;
+        }
+        QFile::remove(segments[i].path);
+        totalBytes -= segments[i].size;
+        segments.removeAt(i);
+    }
+}
+
+// 私有方法
+bool AsyncFileWriter::commit(QQueue<QByteArray>& batch, qint64 batchBytes)
+{
+    // 合并为一次系统调用
+    m_writeBuffer.resize(0);
+    m_writeBuffer.reserve(batchBytes);
+    for (const QByteArray& data : batch) m_writeBuffer.append(data);
+    if (m_file.write(m_writeBuffer) != m_writeBuffer.size())
+    {
+        emit errorOccurred(QString("写入文件失败：%1").arg(m_file.errorString()));
+        return false;
+    }
+    m_bytesWritten.fetch_add(m_writeBuffer.size());
+    m_segmentBytes += m_writeBuffer.size();
+    const SyncPolicy policy = m_syncPolicy.load();
+    if (policy == SyncPolicy::OnCommit || (policy == SyncPolicy::Periodic && m_syncTimer.elapsed() >= SYNC_INTERVAL))
+    {
+        syncToDisk(m_file);
+        m_syncTimer.restart();
+    }
+    this->updateSegmentSize();
+    return true;
+}
+
+bool AsyncFileWriter::writeMapped(const QByteArray& data)
+{
+    // 调用方已持有m_mutex；除换窗口和分段轮转外没有系统调用
+    if (this->shouldRotate(data.size()))
+    {
+        this->closeSegment();
+        if (!this->openSegment())
+        {
+            m_isOpen.store(false);
+            return false;
+        }
+    }
+    if (!m_mappedFile.append(data))
+    {
+        emit errorOccurred(QString("写入文件失败：%1").arg(m_mappedFile.errorString()));
+        return false;
+    }
+    m_bytesWritten.fetch_add(data.size());
+    m_segmentBytes += data.size();
+    const SyncPolicy policy = m_syncPolicy.load();
+    if (policy == SyncPolicy::OnCommit || (policy == SyncPolicy::Periodic && m_syncTimer.elapsed() >= SYNC_INTERVAL))
+    {
+        m_mappedFile.flush();
+        m_syncTimer.restart();
+    }
+    this->updateSegmentSize();
+    return true;
+}
+
+bool AsyncFileWriter::writePrologue()
+{
+    if (!m_prologueSource) return true;
+    std::function<QByteArray()> source;
+    source.swap(m_prologueSource);
+    // 已有数据先于队列中新到达的数据写出，期间新数据在队列中等待
+    QQueue<QByteArray> batch;
+    for (QByteArray chunk = source(); !chunk.isEmpty(); chunk = source())
+    {
+        const qint64 chunkBytes = chunk.size();
+        if (this->shouldRotate(chunkBytes))
+        {
+            this->closeSegment();
+            if (!this->openSegment()) return false;
+        }
+        batch.enqueue(std::move(chunk));
+        if (!this->commit(batch, chunkBytes)) return false;
+        batch.clear();
+    }
+    return true;
+}
+
+void AsyncFileWriter::updateSegmentSize()
+{
+    if (m_pSegments->maxTotalBytes > 0)
+        m_pSegments->updateSegment(m_file.fileName(), m_file.fileName(), m_segmentBytes, true);
+}
+
+bool AsyncFileWriter::openSegment()
+{
+    const QString path = m_rotationConfig.isEnabled() ? this->buildSegmentName() : m_baseFileName;
+    ++m_segmentIndex;
+    m_file.setFileName(path);
+    if (m_storageMode == StorageMode::Mapped)
+    {
+        // 追加模式下续写已有的映射文件，open内部先恢复上次未正常关闭的状态；其他格式的同名文件仍然覆盖
+        const bool append = m_openMode.testFlag(QIODevice::Append) && MappedCaptureWriter::isMappedCapture(path);
+        if (!m_mappedFile.open(path, append))
+        {
+            emit errorOccurred(QString("无法打开文件：%1").arg(m_mappedFile.errorString()));
+            return false;
+        }
+    }
+    else if (!m_file.open(m_openMode))
+    {
+        emit errorOccurred(QString("无法打开文件：%1").arg(m_file.errorString()));
+        return false;
+    }
+    m_segmentBytes = m_storageMode == StorageMode::Mapped ? m_mappedFile.size() : m_file.size();
+    // 续写的文件开头已经有文件头
+    if (!m_segmentHeader.isEmpty() && m_segmentBytes == 0)
+    {
+        const bool written = m_storageMode == StorageMode::Mapped
+                                 ? m_mappedFile.append(m_segmentHeader)
+                                 : m_file.write(m_segmentHeader) == m_segmentHeader.size();
+        if (!written)
+        {
+            emit errorOccurred(QString("写入文件失败：%1").arg(m_file.errorString()));
+            m_file.close();
+            m_mappedFile.close();
+            return false;
+        }
+        m_segmentBytes = m_segmentHeader.size();
+    }
+    m_segmentTimer.start();
+    {
+        QMutexLocker locker(&m_pSegments->mutex);
+        SegmentRecord record;
+        record.path = path;
+        record.busy = true;
+        m_pSegments->segments.append(record);
+    }
+    emit segmentOpened(path);
+    return true;
+}
+
+void AsyncFileWriter::closeSegment()
+{
+    if (!m_file.isOpen() && !m_mappedFile.isOpen()) return;
+    const QString path = m_file.fileName();
+    // 映射文件关闭时截断预分配区域，大小需加上文件头
+    const qint64 size = m_mappedFile.isOpen() ? m_segmentBytes + MappedCaptureWriter::HEADER_SIZE : m_segmentBytes;
+    m_file.close();
+    // 截断失败时文件仍带着预分配的空白区域，不压缩，按实际大小计入磁盘占用
+    const bool isTruncated = m_mappedFile.close();
+    if (!isTruncated) emit errorOccurred(m_mappedFile.errorString());
+    emit segmentClosed(path);
+    if (!isTruncated)
+    {
+        m_pSegments->updateSegment(path, path, QFileInfo(path).size(), false);
+        return;
+    }
+    if (!m_rotationConfig.compressClosedSegments || m_segmentBytes <= m_segmentHeader.size())
+    {
+        m_pSegments->updateSegment(path, path, size, false);
+        return;
+    }
+    // 在线程池中压缩已关闭的分段，压缩完成后更新分段记录并检查磁盘占用
+    std::shared_ptr<SegmentRegistry> registry = m_pSegments;
+    ThreadPoolManager::addTask([registry, path, size]
+    {
+        const QString target = path + ".gz";
+        QString errorString;
+        if (LogSegmentCompressor::compressFile(path, target, errorString))
+        {
+            registry->updateSegment(path, target, QFileInfo(target).size(), false);
+            return;
+        }
+        qWarning() << "Failed to compress log segment" << path << ":" << errorString;
+        registry->updateSegment(path, path, size, false);
+    });
+}
+
+bool AsyncFileWriter::shouldRotate(qint64 batchBytes) const
+{
+    // 只有文件头的分段不再轮转
+    if (!m_rotationConfig.isEnabled() || m_segmentBytes <= m_segmentHeader.size()) return false;
+    if (m_rotationConfig.maxSegmentBytes > 0 && m_segmentBytes + batchBytes > m_rotationConfig.maxSegmentBytes)
+        return true;
+    return m_rotationConfig.maxSegmentSeconds > 0 &&
+        m_segmentTimer.elapsed() >= qint64(m_rotationConfig.maxSegmentSeconds) * 1000;
+}
+
+QString AsyncFileWriter::buildSegmentName() const
+{
+    const QFileInfo baseInfo(m_baseFileName);
+    const QDateTime now = QDateTime::currentDateTime();
+    QString name = m_rotationConfig.nameTemplate.isEmpty()
+                       ? LogRotationConfig().nameTemplate
+                       : m_rotationConfig.nameTemplate;
+    name.replace("{name}", baseInfo.completeBaseName())
+        .replace("{suffix}", baseInfo.suffix().isEmpty() ? QString("txt") : baseInfo.suffix())
+        .replace("{index}", QString("%1").arg(m_segmentIndex, 4, 10, QChar('0')))
+        .replace("{date}", now.toString("yyyyMMdd"))
+        .replace("{time}", now.toString("HHmmss"));
+    return baseInfo.absoluteDir().filePath(name);
+}
+
+bool AsyncFileWriter::syncToDisk(QFile& file)
+{
+    file.flush();
+#ifdef Q_OS_WIN
+    return _commit(file.handle()) == 0;
+#else
+    return ::fsync(file.handle()) == 0;
+#endif
+}
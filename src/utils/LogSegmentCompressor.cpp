@@ -0,0 +1,100 @@
+/**
+  ******************************************************************************
+  * @file           : LogSegmentCompressor.cpp
+  * @author         : wangxiangyu
+  * @brief          : 日志分段压缩实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/LogSegmentCompressor.h"
+#include <QtEndian>
+#include <array>
+
+namespace
+{
+    constexpr std::array<quint32, 256> makeCrcTable()
+    {
+        std::array<quint32, 256> table{};
+        for (quint32 i = 0; i < 256; ++i)
+        {
+            quint32 crc = i;
+            for (int bit = 0; bit < 8; ++bit) crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+            table[i] = crc;
+        }
+        return table;
+    }
+
+    constexpr std::array<quint32, 256> CRC_TABLE = makeCrcTable();
+}
+
+quint32 LogSegmentCompressor::crc32(const char* data, qsizetype size, quint32 crc)
+{
+    crc = ~crc;
+    for (qsizetype i = 0; i < size; ++i)
+        crc = CRC_TABLE[(crc ^ static_cast<quint8>(data[i])) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+QByteArray LogSegmentCompressor::compressBlock(const QByteArray& block, int level)
+{
+    // qCompress输出为：4字节原始长度(大端) + zlib头(2字节) + deflate数据 + adler32(4字节)
+    // gzip成员需要的是裸deflate数据，去掉前后包装后重新加上gzip头尾
+    const QByteArray zlibData = qCompress(block, level);
+    constexpr qsizetype prefixSize = 4 + 2;
+    constexpr qsizetype suffixSize = 4;
+    if (zlibData.size() < prefixSize + suffixSize) return QByteArray();
+    static const char header[10] = {'\x1f', '\x8b', '\x08', 0, 0, 0, 0, 0, 0, '\xff'};
+    QByteArray member;
+    member.reserve(zlibData.size() + 18);
+    member.append(header, sizeof(header));
+    member.append(zlibData.constData() + prefixSize, zlibData.size() - prefixSize - suffixSize);
+    const quint32 crc = qToLittleEndian(crc32(block.constData(), block.size()));
+    const quint32 inputSize = qToLittleEndian(static_cast<quint32>(block.size()));
+    member.append(reinterpret_cast<const char*>(&crc), sizeof(crc));
+    member.append(reinterpret_cast<const char*>(&inputSize), sizeof(inputSize));
+    return member;
+}
+
+bool LogSegmentCompressor::compressFile(const QString& source, const QString& target, QString& errorString)
+{
+    QFile input(source);
+    if (!input.open(QIODevice::ReadOnly))
+    {
+        errorString = input.errorString();
+        return false;
+    }
+    // 先写临时文件，完成后再改名，避免留下不完整的压缩文件
+    const QString temporaryName = target + ".part";
+    QFile output(temporaryName);
+    if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        errorString = output.errorString();
+        return false;
+    }
+    while (!input.atEnd())
+    {
+        const QByteArray block = input.read(BLOCK_SIZE);
+        if (block.isEmpty()) break;
+        const QByteArray member = compressBlock(block);
+        if (member.isEmpty() || output.write(member) != member.size())
+        {
+            errorString = member.isEmpty() ? QString("压缩失败") : output.errorString();
+            output.close();
+            output.remove();
+            return false;
+        }
+    }
+    input.close();
+    output.close();
+    QFile::remove(target);
+    if (!QFile::rename(temporaryName, target))
+    {
+        errorString = QString("无法重命名压缩文件");
+        QFile::remove(temporaryName);
+        return false;
+    }
+    QFile::remove(source);
+    return true;
+}
@@ -0,0 +1,300 @@
+/**
+  ******************************************************************************
+  * @file           : MappedCaptureWriter.cpp
+  * @author         : wangxiangyu
+  * @brief          : 预分配+内存映射的捕获文件写入实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/MappedCaptureWriter.h"
+#include <QtEndian>
+#include <atomic>
+#include <cstring>
+#include <cstddef>
+#ifdef Q_OS_WIN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#include <fcntl.h>
+#endif
+
+// 构造函数和析构函数
+MappedCaptureWriter::~MappedCaptureWriter()
+{
+    this->close();
+}
+
+bool MappedCaptureWriter::open(const QString& fileName, bool append)
+{
+    this->close();
+    m_errorString.clear();
+    if (append && QFile::exists(fileName) && !recover(fileName, m_errorString)) return false;
+    m_file.setFileName(fileName);
+    QIODevice::OpenMode mode = QIODevice::ReadWrite;
+    if (!append) mode |= QIODevice::Truncate;
+    if (!m_file.open(mode))
+    {
+        m_errorString = m_file.errorString();
+        return false;
+    }
+    m_committedLength = 0;
+    if (append && m_file.size() >= HEADER_SIZE)
+    {
+        m_committedLength = readCommittedLength(m_file);
+        if (m_committedLength < 0)
+        {
+            m_errorString = QString("不是有效的映射捕获文件");
+            m_file.close();
+            return false;
+        }
+    }
+    m_allocatedSize = m_file.size();
+    if (!this->ensureCapacity(m_committedLength))
+    {
+        m_file.close();
+        return false;
+    }
+    if (!this->mapHeader())
+    {
+        m_file.close();
+        return false;
+    }
+    if (m_committedLength == 0)
+    {
+        memset(m_pHeader, 0, HEADER_SIZE);
+        memcpy(m_pHeader->magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+        m_pHeader->version = qToLittleEndian(FILE_VERSION);
+        m_pHeader->headerSize = qToLittleEndian<quint16>(HEADER_SIZE);
+    }
+    m_pHeader->flags = qToLittleEndian<quint32>(DirtyFlag);
+    this->storeCommittedLength(m_committedLength);
+    m_flushedLength = m_committedLength;
+    if (!this->mapWindow(m_committedLength))
+    {
+        this->close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedCaptureWriter::close()
+{
+    if (!m_file.isOpen()) return true;
+    // Windows下存在映射视图时不能截断文件，先解除全部映射
+    this->unmapWindow();
+    this->unmapHeader();
+    // 先把数据区截断到已提交长度，再清除脏标记，顺序保证中途失败或崩溃时下次打开仍会恢复
+    bool ok = m_file.resize(HEADER_SIZE + m_committedLength);
+    if (ok)
+    {
+        const quint32 flags = 0;
+        ok = m_file.seek(offsetof(FileHeader, flags))
+            && m_file.write(reinterpret_cast<const char*>(&flags), sizeof(flags)) == sizeof(flags)
+            && m_file.flush();
+    }
+    if (!ok) m_errorString = QString("截断映射捕获文件失败：%1").arg(m_file.errorString());
+    m_file.close();
+    m_allocatedSize = 0;
+    return ok;
+}
+
+bool MappedCaptureWriter::append(const char* data, qsizetype size)
+{
+    if (!m_pHeader) return false;
+    while (size > 0)
+    {
+        qint64 windowUsed = m_committedLength - m_windowOffset;
+        if (windowUsed >= m_windowSize)
+        {
+            if (!this->mapWindow(m_committedLength)) return false;
+            windowUsed = 0;
+        }
+        const qint64 chunk = qMin<qint64>(size, m_windowSize - windowUsed);
+        memcpy(m_pWindow + windowUsed, data, chunk);
+        data += chunk;
+        size -= chunk;
+        m_committedLength += chunk;
+    }
+    // 数据拷贝完成后才发布新的长度
+    this->storeCommittedLength(m_committedLength);
+    return true;
+}
+
+bool MappedCaptureWriter::append(const QByteArray& data)
+{
+    return this->append(data.constData(), data.size());
+}
+
+bool MappedCaptureWriter::flush()
+{
+    if (!m_pHeader) return false;
+    // 先写回数据页，再写回文件头，保证磁盘上的已提交长度不超过已落盘的数据
+    const qint64 start = qMax(m_flushedLength, m_windowOffset);
+    bool ok = true;
+    if (m_pWindow && m_committedLength > start)
+        ok = syncRange(m_pWindow + (start - m_windowOffset), m_committedLength - start);
+    ok = syncRange(reinterpret_cast<uchar*>(m_pHeader), HEADER_SIZE) && ok;
+    if (ok) m_flushedLength = m_committedLength;
+    return ok;
+}
+
+bool MappedCaptureWriter::isOpen() const
+{
+    return m_pHeader != nullptr;
+}
+
+qint64 MappedCaptureWriter::size() const
+{
+    return m_committedLength;
+}
+
+QString MappedCaptureWriter::fileName() const
+{
+    return m_file.fileName();
+}
+
+QString MappedCaptureWriter::errorString() const
+{
+    return m_errorString;
+}
+
+qint64 MappedCaptureWriter::readCommittedLength(QIODevice& device)
+{
+    FileHeader header;
+    if (device.read(reinterpret_cast<char*>(&header), HEADER_SIZE) != HEADER_SIZE) return -1;
+    if (memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) return -1;
+    if (qFromLittleEndian(header.version) != FILE_VERSION) return -1;
+    return static_cast<qint64>(qFromLittleEndian(header.committedLength));
+}
+
+bool MappedCaptureWriter::isMappedCapture(const QString& fileName)
+{
+    QFile file(fileName);
+    return file.open(QIODevice::ReadOnly) && readCommittedLength(file) >= 0;
+}
+
+bool MappedCaptureWriter::recover(const QString& fileName, QString& errorString)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadWrite))
+    {
+        errorString = file.errorString();
+        return false;
+    }
+    FileHeader header;
+    if (file.read(reinterpret_cast<char*>(&header), HEADER_SIZE) != HEADER_SIZE ||
+        memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0)
+    {
+        errorString = QString("不是有效的映射捕获文件");
+        return false;
+    }
+    if (!(qFromLittleEndian(header.flags) & DirtyFlag)) return true;
+    // 上次未正常关闭：丢弃已提交长度之后的预分配区域
+    const qint64 committedLength = static_cast<qint64>(qFromLittleEndian(header.committedLength));
+    const qint64 dataLength = qBound<qint64>(0, committedLength, file.size() - HEADER_SIZE);
+    if (!file.resize(HEADER_SIZE + dataLength))
+    {
+        errorString = file.errorString();
+        return false;
+    }
+    header.flags = 0;
+    header.committedLength = qToLittleEndian<quint64>(dataLength);
+    file.seek(0);
+    if (file.write(reinterpret_cast<const char*>(&header), HEADER_SIZE) != HEADER_SIZE)
+    {
+        errorString = file.errorString();
+        return false;
+    }
+    return true;
+}
+
+// 私有方法
+bool MappedCaptureWriter::ensureCapacity(qint64 dataEnd)
+{
+    const qint64 required = HEADER_SIZE + dataEnd;
+    if (required <= m_allocatedSize) return true;
+    // 按大块扩展文件，减少碎片和扩展次数
+    const qint64 newSize = (required / PREALLOCATE_SIZE + 1) * PREALLOCATE_SIZE;
+    // Windows下存在映射视图时不能改变文件大小：数据窗口已由调用方解除，文件头在扩展期间也解除映射
+    const bool isHeaderMapped = m_pHeader != nullptr;
+    this->unmapHeader();
+    const bool ok = preallocate(m_file, newSize);
+    if (ok) m_allocatedSize = newSize;
+    else m_errorString = QString("预分配文件空间失败：%1").arg(m_file.errorString());
+    if (isHeaderMapped && !this->mapHeader()) return false;
+    return ok;
+}
+
+bool MappedCaptureWriter::mapHeader()
+{
+    m_pHeader = reinterpret_cast<FileHeader*>(m_file.map(0, HEADER_SIZE));
+    if (m_pHeader) return true;
+    m_errorString = m_file.errorString();
+    return false;
+}
+
+void MappedCaptureWriter::unmapHeader()
+{
+    if (!m_pHeader) return;
+    syncRange(reinterpret_cast<uchar*>(m_pHeader), HEADER_SIZE);
+    m_file.unmap(reinterpret_cast<uchar*>(m_pHeader));
+    m_pHeader = nullptr;
+}
+
+bool MappedCaptureWriter::mapWindow(qint64 dataOffset)
+{
+    this->unmapWindow();
+    if (!this->ensureCapacity(dataOffset + WINDOW_SIZE)) return false;
+    m_pWindow = m_file.map(HEADER_SIZE + dataOffset, WINDOW_SIZE);
+    if (!m_pWindow)
+    {
+        m_errorString = m_file.errorString();
+        return false;
+    }
+    m_windowOffset = dataOffset;
+    m_windowSize = WINDOW_SIZE;
+    return true;
+}
+
+void MappedCaptureWriter::unmapWindow()
+{
+    if (!m_pWindow) return;
+    // 换窗口前写回本窗口中尚未落盘的数据，之后flush()只需处理当前窗口
+    const qint64 start = qMax(m_flushedLength, m_windowOffset);
+    if (m_committedLength > start) syncRange(m_pWindow + (start - m_windowOffset), m_committedLength - start);
+    m_file.unmap(m_pWindow);
+    m_pWindow = nullptr;
+    m_windowSize = 0;
+}
+
+void MappedCaptureWriter::storeCommittedLength(qint64 length)
+{
+    // 8字节对齐的单次存储，崩溃后读到的长度要么是旧值要么是新值
+    std::atomic_ref<quint64> committedLength(m_pHeader->committedLength);
+    committedLength.store(qToLittleEndian<quint64>(length), std::memory_order_release);
+}
+
+bool MappedCaptureWriter::preallocate(QFile& file, qint64 size)
+{
+#ifdef Q_OS_LINUX
+    // 真正分配磁盘块，避免稀疏文件在写入时才分配导致碎片
+    if (::posix_fallocate(file.handle(), 0, size) == 0) return true;
+#endif
+    return file.resize(size);
+}
+
+bool MappedCaptureWriter::syncRange(uchar* address, qint64 size)
+{
+#ifdef Q_OS_WIN
+    return FlushViewOfFile(address, static_cast<SIZE_T>(size)) != 0;
+#else
+    // msync要求起始地址按页对齐
+    static const quintptr pageSize = static_cast<quintptr>(::sysconf(_SC_PAGESIZE));
+    const quintptr begin = reinterpret_cast<quintptr>(address) & ~(pageSize - 1);
+    const quintptr end = reinterpret_cast<quintptr>(address) + static_cast<quintptr>(size);
+    return ::msync(reinterpret_cast<void*>(begin), end - begin, MS_SYNC) == 0;
+#endif
+}
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusRttHistogram.cpp
+  * @author         : wangxiangyu
+  * @brief          : 对数分桶的响应延迟直方图实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/ModbusRttHistogram.h"
+#include <cmath>
+
+void ModbusRttHistogram::addSample(double milliseconds)
+{
+    if (m_sampleCount >= MAX_SAMPLES)
+    {
+        // 整体减半，相当于按样本数做指数衰减
+        m_sampleCount = 0;
+        for (quint32& count : m_buckets)
+        {
+            count /= 2;
+            m_sampleCount += count;
+        }
+    }
+    ++m_buckets[bucketIndex(milliseconds)];
+    ++m_sampleCount;
+}
+
+void ModbusRttHistogram::clear()
+{
+    m_buckets.fill(0);
+    m_sampleCount = 0;
+}
+
+quint32 ModbusRttHistogram::getSampleCount() const
+{
+    return m_sampleCount;
+}
+
+double ModbusRttHistogram::percentile(double fraction) const
+{
+    if (m_sampleCount == 0) return 0.0;
+    const auto target = static_cast<quint32>(std::ceil(qBound(0.0, fraction, 1.0) * m_sampleCount));
+    quint32 cumulative = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i)
+    {
+        cumulative += m_buckets[i];
+        if (cumulative >= target && cumulative > 0) return bucketUpperBound(i);
+    }
+    return bucketUpperBound(BUCKET_COUNT - 1);
+}
+
+// 私有方法
+int ModbusRttHistogram::bucketIndex(double milliseconds)
+{
+    if (!(milliseconds > MIN_VALUE)) return 0;
+    const int index = static_cast<int>(std::ceil(std::log(milliseconds / MIN_VALUE) / std::log(GROWTH_FACTOR)));
+    return qBound(0, index, BUCKET_COUNT - 1);
+}
+
+double ModbusRttHistogram::bucketUpperBound(int index)
+{
+    return MIN_VALUE * std::pow(GROWTH_FACTOR, index);
+}
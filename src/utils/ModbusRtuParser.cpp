@@ -0,0 +1,252 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusRtuParser.cpp
+  * @author         : wangxiangyu
+  * @brief          : Modbus RTU帧解析器实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/ModbusRtuParser.h"
+
+namespace
+{
+    // 字节计数字段位于offset处，帧长 = offset + 1 + 字节数 + CRC
+    int lengthWithByteCount(const char* data, qsizetype available, int offset, int maxByteCount = 252)
+    {
+        if (available <= offset) return 0;
+        const int byteCount = static_cast<quint8>(data[offset]);
+        if (byteCount > maxByteCount) return -1;
+        return offset + 1 + byteCount + 2;
+    }
+}
+
+// 构造函数和析构函数
+ModbusRtuParser::ModbusRtuParser(FrameType type)
+    : m_frameType(type)
+{
+}
+
+void ModbusRtuParser::append(const QByteArray& data)
+{
+    this->compact();
+    m_buffer.append(data);
+}
+
+bool ModbusRtuParser::nextFrame(QByteArray& frame)
+{
+    while (m_buffer.size() - m_readPos >= MIN_FRAME_SIZE)
+    {
+        const char* data = m_buffer.constData() + m_readPos;
+        const qsizetype available = m_buffer.size() - m_readPos;
+        const int frameLength = this->frameLength(data, available);
+        if (frameLength < 0)
+        {
+            this->skipByte();
+            continue;
+        }
+        if (frameLength == 0 || available < frameLength)
+        {
+            // 噪声可能恰好被当作长帧的开头，真正的帧落在其等待的范围内；
+            // 候选帧未收全时向后查找已完整且校验通过的帧，避免一直等到下一批数据
+            if (this->resyncAhead()) continue;
+            // 先把已到达的字节计入CRC，等待更多数据
+            this->advanceCrc(m_buffer.size());
+            return false;
+        }
+        // 整帧连同CRC计算余数，为0即校验通过
+        this->advanceCrc(m_readPos + frameLength);
+        if (m_crcValue != 0)
+        {
+            ++m_crcErrorCount;
+            this->skipByte();
+            continue;
+        }
+        frame = QByteArray(data, frameLength - 2);
+        m_readPos += frameLength;
+        m_crcEnd = m_readPos;
+        m_crcValue = ModbusCrc::INITIAL_VALUE;
+        return true;
+    }
+    return false;
+}
+
+void ModbusRtuParser::clear()
+{
+    m_buffer.clear();
+    m_readPos = 0;
+    m_crcEnd = 0;
+    m_crcValue = ModbusCrc::INITIAL_VALUE;
+    m_discardedBytes = 0;
+    m_crcErrorCount = 0;
+}
+
+ModbusRtuParser::FrameType ModbusRtuParser::getFrameType() const
+{
+    return m_frameType;
+}
+
+qsizetype ModbusRtuParser::getPendingBytes() const
+{
+    return m_buffer.size() - m_readPos;
+}
+
+qint64 ModbusRtuParser::getDiscardedBytes() const
+{
+    return m_discardedBytes;
+}
+
+qint64 ModbusRtuParser::getCrcErrorCount() const
+{
+    return m_crcErrorCount;
+}
+
+int ModbusRtuParser::responseLength(const char* data, qsizetype available)
+{
+    if (available < 2) return 0;
+    const quint8 functionCode = static_cast<quint8>(data[1]);
+    if (functionCode & 0x80) return 5; // 异常响应：从站+功能码+异常码+CRC
+    switch (functionCode)
+    {
+    case 0x01: // 读线圈
+    case 0x02: // 读离散输入
+        return lengthWithByteCount(data, available, 2, 250);
+    case 0x03: // 读保持寄存器
+    case 0x04: // 读输入寄存器
+    case 0x17: // 读写多个寄存器
+    {
+        if (available < 3) return 0;
+        const int byteCount = static_cast<quint8>(data[2]);
+        if (byteCount == 0 || byteCount % 2 != 0 || byteCount > 250) return -1;
+        return 3 + byteCount + 2;
+    }
+    case 0x05: // 写单个线圈
+    case 0x06: // 写单个寄存器
+    case 0x08: // 诊断(回送子功能码和数据)
+    case 0x0B: // 读通信事件计数器
+    case 0x0F: // 写多个线圈
+    case 0x10: // 写多个寄存器
+        return 8;
+    case 0x07: // 读异常状态
+        return 5;
+    case 0x0C: // 读通信事件日志
+    case 0x11: // 报告从站ID
+    case 0x14: // 读文件记录
+    case 0x15: // 写文件记录
+        return lengthWithByteCount(data, available, 2);
+    case 0x16: // 屏蔽写寄存器
+        return 10;
+    case 0x18: // 读FIFO队列，字节计数为2字节
+    {
+        if (available < 4) return 0;
+        const int byteCount = (static_cast<quint8>(data[2]) << 8) | static_cast<quint8>(data[3]);
+        if (byteCount > 250) return -1;
+        return 4 + byteCount + 2;
+    }
+    default:
+        return -1;
+    }
+}
+
+int ModbusRtuParser::requestLength(const char* data, qsizetype available)
+{
+    if (available < 2) return 0;
+    const quint8 functionCode = static_cast<quint8>(data[1]);
+    switch (functionCode)
+    {
+    case 0x01:
+    case 0x02:
+    case 0x03:
+    case 0x04:
+    case 0x05:
+    case 0x06:
+    case 0x08:
+        return 8; // 从站+功能码+地址/子功能码+数量/数据+CRC
+    case 0x07:
+    case 0x0B:
+    case 0x0C:
+    case 0x11:
+        return 4; // 只有从站和功能码
+    case 0x0F:
+    case 0x10:
+        return lengthWithByteCount(data, available, 6, 246);
+    case 0x14:
+    case 0x15:
+        return lengthWithByteCount(data, available, 2);
+    case 0x16:
+        return 10;
+    case 0x17:
+        return lengthWithByteCount(data, available, 10, 242);
+    case 0x18:
+        return 6;
+    default:
+        return -1;
+    }
+}
+
+// 私有方法
+int ModbusRtuParser::frameLength(const char* data, qsizetype available) const
+{
+    // 从站地址0为广播，从站不会应答；248以上为保留地址
+    const quint8 slaveId = static_cast<quint8>(data[0]);
+    const bool slaveValid = m_frameType == FrameType::Request ? slaveId <= 247 : (slaveId >= 1 && slaveId <= 247);
+    if (!slaveValid) return -1;
+    const int length = m_frameType == FrameType::Request ? requestLength(data, available) : responseLength(data, available);
+    return length > MAX_FRAME_SIZE ? -1 : length;
+}
+
+bool ModbusRtuParser::resyncAhead()
+{
+    // 未收全的候选帧不超过MAX_FRAME_SIZE，查找范围和每次校验的长度都有上限
+    const char* data = m_buffer.constData() + m_readPos;
+    const qsizetype available = m_buffer.size() - m_readPos;
+    for (qsizetype offset = 1; offset + MIN_FRAME_SIZE <= available; ++offset)
+    {
+        const int length = this->frameLength(data + offset, available - offset);
+        if (length <= 0 || length > available - offset) continue;
+        if (!ModbusCrc::verify(data + offset, length)) continue;
+        m_readPos += offset;
+        m_discardedBytes += offset;
+        m_crcEnd = m_readPos;
+        m_crcValue = ModbusCrc::INITIAL_VALUE;
+        return true;
+    }
+    return false;
+}
+
+void ModbusRtuParser::skipByte()
+{
+    // 只移动游标，帧起点变化后之前的CRC中间结果失效
+    ++m_readPos;
+    ++m_discardedBytes;
+    m_crcEnd = m_readPos;
+    m_crcValue = ModbusCrc::INITIAL_VALUE;
+}
+
+void ModbusRtuParser::advanceCrc(qsizetype end)
+{
+    if (end <= m_crcEnd) return;
+    m_crcValue = ModbusCrc::update(m_crcValue, m_buffer.constData() + m_crcEnd, end - m_crcEnd);
+    m_crcEnd = end;
+}
+
+void ModbusRtuParser::compact()
+{
+    if (m_readPos == 0) return;
+    if (m_readPos == m_buffer.size())
+    {
+        // 全部消费完时直接清空，保留已分配的容量
+        m_buffer.resize(0);
+    }
+    else if (m_readPos >= COMPACT_THRESHOLD && m_readPos * 2 >= m_buffer.size())
+    {
+        m_buffer.remove(0, m_readPos);
+    }
+    else
+    {
+        return;
+    }
+    m_crcEnd -= m_readPos;
+    m_readPos = 0;
+}
@@ -0,0 +1,394 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusTagFile.cpp
+  * @author         : wangxiangyu
+  * @brief          : Modbus点位表导入导出实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/ModbusTagFile.h"
+#include <QSaveFile>
+#include <QLocale>
+#include <algorithm>
+
+// 静态成员变量
+const QStringList ModbusTagFile::COLUMNS = {
+    "name", "slaveId", "functionCode", "address", "dataType", "byteOrder",
+    "gain", "offset", "scanInterval", "scanPriority", "channelId"
+};
+
+// 构造函数和析构函数
+ModbusTagFile::ModbusTagFile(const QString& fileName, Format format, QObject* parent)
+    : QObject(parent), m_fileName(fileName), m_format(format)
+{
+}
+
+void ModbusTagFile::load()
+{
+    QFile file(m_fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        emit loaded(false, QString("无法打开文件：%1").arg(file.errorString()), QList<ModbusTag>());
+        return;
+    }
+    const QByteArray data = file.readAll();
+    file.close();
+    QList<ModbusTag> tags;
+    const bool ok = m_format == Format::Csv ? this->readCsv(data, tags) : this->readJson(data, tags);
+    if (!ok || m_errorCount > 0)
+    {
+        QString message = QString("导入失败，共 %1 处错误：\n%2").arg(m_errorCount).arg(m_errors.join("\n"));
+        if (m_errorCount > m_errors.size()) message += "\n……";
+        emit loaded(false, message, QList<ModbusTag>());
+        return;
+    }
+    if (tags.isEmpty())
+    {
+        emit loaded(false, "文件中没有点位", QList<ModbusTag>());
+        return;
+    }
+    emit loaded(true, QString("已导入 %1 个点位").arg(tags.size()), tags);
+}
+
+void ModbusTagFile::save(const QList<ModbusTag>& tags)
+{
+    // 先写入临时文件，完成后再替换，写入失败不会破坏原有的点位表文件
+    QSaveFile file(m_fileName);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        emit saved(false, QString("无法创建文件：%1").arg(file.errorString()));
+        return;
+    }
+    file.write(m_format == Format::Csv ? this->writeCsv(tags) : this->writeJson(tags));
+    if (!file.commit())
+    {
+        emit saved(false, QString("写入文件失败：%1").arg(file.errorString()));
+        return;
+    }
+    emit saved(true, QString("已导出 %1 个点位").arg(tags.size()));
+}
+
+ModbusTagFile::Format ModbusTagFile::formatFromFileName(const QString& fileName)
+{
+    return fileName.endsWith(".json", Qt::CaseInsensitive) ? Format::Json : Format::Csv;
+}
+
+const QStringList& ModbusTagFile::getColumns()
+{
+    return COLUMNS;
+}
+
+// 私有方法
+bool ModbusTagFile::readCsv(const QByteArray& data, QList<ModbusTag>& tags)
+{
+    QString text = QString::fromUtf8(data);
+    if (text.startsWith(QChar(0xFEFF))) text.remove(0, 1); // 表格软件保存的UTF-8文件可能带BOM
+    const QStringList lines = text.split('\n');
+    QStringList header;
+    for (int i = 0; i < lines.size(); ++i)
+    {
+        QString line = lines[i];
+        if (line.endsWith('\r')) line.chop(1);
+        // 跳过空行和#开头的注释行
+        if (line.trimmed().isEmpty() || line.startsWith('#')) continue;
+        const QString location = QString("第%1行").arg(i + 1);
+        bool ok = false;
+        const QStringList fields = splitCsvLine(line, &ok);
+        if (!ok)
+        {
+            this->addError(location, "引号不匹配");
+            continue;
+        }
+        if (header.isEmpty())
+        {
+            // 表头按列名识别，大小写不敏感，未知的列(如备注)忽略
+            for (const QString& field : fields)
+            {
+                const QString name = field.trimmed();
+                auto it = std::find_if(COLUMNS.cbegin(), COLUMNS.cend(), [&name](const QString& column)
+                {
+                    return column.compare(name, Qt::CaseInsensitive) == 0;
+                });
+                header.append(it != COLUMNS.cend() ? *it : QString());
+            }
+            for (const QString& column : {"name", "slaveId", "functionCode", "address"})
+            {
+                if (!header.contains(column))
+                {
+                    this->addError(location, QString("表头缺少必需的列 %1").arg(column));
+                    return false;
+                }
+            }
+            continue;
+        }
+        QHash<QString, QString> values;
+        for (int c = 0; c < fields.size() && c < header.size(); ++c)
+        {
+            if (!header[c].isEmpty()) values.insert(header[c], fields[c]);
+        }
+        ModbusTag tag;
+        if (this->parseTag(values, location, tag)) tags.append(tag);
+    }
+    if (header.isEmpty()) this->addError("文件", "没有表头");
+    return !header.isEmpty();
+}
+
+bool ModbusTagFile::readJson(const QByteArray& data, QList<ModbusTag>& tags)
+{
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(data, &error);
+    if (error.error != QJsonParseError::NoError)
+    {
+        this->addError(QString("第%1个字符").arg(error.offset), error.errorString());
+        return false;
+    }
+    // 支持 {"tags":[...]} 和直接以数组作为根两种写法
+    const QJsonArray array = document.isArray() ? document.array() : document.object().value("tags").toArray();
+    for (int i = 0; i < array.size(); ++i)
+    {
+        const QString location = QString("第%1个点位").arg(i + 1);
+        if (!array[i].isObject())
+        {
+            this->addError(location, "不是对象");
+            continue;
+        }
+        // 转为文本后与CSV共用同一套校验
+        const QJsonObject object = array[i].toObject();
+        QHash<QString, QString> values;
+        for (auto it = object.constBegin(); it != object.constEnd(); ++it)
+        {
+            const QString name = it.key();
+            auto column = std::find_if(COLUMNS.cbegin(), COLUMNS.cend(), [&name](const QString& c)
+            {
+                return c.compare(name, Qt::CaseInsensitive) == 0;
+            });
+            if (column != COLUMNS.cend()) values.insert(*column, it.value().toVariant().toString());
+        }
+        ModbusTag tag;
+        if (this->parseTag(values, location, tag)) tags.append(tag);
+    }
+    return true;
+}
+
+QByteArray ModbusTagFile::writeCsv(const QList<ModbusTag>& tags) const
+{
+    // 带BOM的UTF-8，表格软件直接打开时中文点位名不会乱码
+    QString text = QChar(0xFEFF) + COLUMNS.join(',') + "\r\n";
+    for (const ModbusTag& tag : tags)
+    {
+        const QHash<QString, QString> fields = tagFields(tag);
+        QStringList row;
+        for (const QString& column : COLUMNS) row.append(quoteCsvField(fields.value(column)));
+        text += row.join(',') + "\r\n";
+    }
+    return text.toUtf8();
+}
+
+QByteArray ModbusTagFile::writeJson(const QList<ModbusTag>& tags) const
+{
+    QJsonArray array;
+    for (const ModbusTag& tag : tags)
+    {
+        QJsonObject object;
+        object.insert("name", tag.name);
+        object.insert("slaveId", tag.slaveId);
+        object.insert("functionCode", tag.functionCode);
+        object.insert("address", tag.address);
+        object.insert("dataType", dataTypeName(tag.dataType));
+        object.insert("byteOrder", byteOrderName(tag.byteOrder));
+        object.insert("gain", tag.gain);
+        object.insert("offset", tag.offset);
+        object.insert("scanInterval", tag.scanInterval);
+        object.insert("scanPriority", tag.scanPriority);
+        object.insert("channelId", tag.channelId);
+        array.append(object);
+    }
+    QJsonObject root;
+    root.insert("version", 1);
+    root.insert("tags", array);
+    return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+bool ModbusTagFile::parseTag(const QHash<QString, QString>& fields, const QString& location, ModbusTag& tag)
+{
+    const int errorCount = m_errorCount;
+    // 整数字段，为空时取默认值；0x开头按十六进制解析
+    auto parseInt = [&](const QString& column, int minimum, int maximum, int& value)
+    {
+        const QString text = fields.value(column).trimmed();
+        if (text.isEmpty()) return;
+        bool ok = false;
+        const int parsed = text.startsWith("0x", Qt::CaseInsensitive) ? text.mid(2).toInt(&ok, 16) : text.toInt(&ok);
+        if (!ok || parsed < minimum || parsed > maximum)
+        {
+            this->addError(location, QString("%1 的值 \"%2\" 无效，应为 %3~%4")
+                           .arg(column, text).arg(minimum).arg(maximum));
+            return;
+        }
+        value = parsed;
+    };
+    auto parseDouble = [&](const QString& column, double& value)
+    {
+        const QString text = fields.value(column).trimmed();
+        if (text.isEmpty()) return;
+        bool ok = false;
+        const double parsed = text.toDouble(&ok);
+        if (!ok || !qIsFinite(parsed))
+        {
+            this->addError(location, QString("%1 的值 \"%2\" 不是有效的数字").arg(column, text));
+            return;
+        }
+        value = parsed;
+    };
+
+    tag.name = fields.value("name").trimmed();
+    if (tag.name.isEmpty()) this->addError(location, "点位名称为空");
+    for (const QString& column : {"slaveId", "functionCode", "address"})
+    {
+        if (fields.value(column).trimmed().isEmpty()) this->addError(location, QString("缺少 %1").arg(column));
+    }
+    parseInt("slaveId", 1, 247, tag.slaveId);
+    parseInt("functionCode", 1, 4, tag.functionCode);
+    parseInt("address", 0, 65535 + ModbusUtils::addressBase(tag.functionCode), tag.address);
+    parseInt("scanInterval", 0, 60000, tag.scanInterval);
+    parseDouble("gain", tag.gain);
+    parseDouble("offset", tag.offset);
+    tag.channelId = fields.value("channelId").trimmed();
+
+    const QString dataType = fields.value("dataType").trimmed();
+    if (!dataType.isEmpty())
+    {
+        static const QHash<QString, ModbusTag::DataType> dataTypes = {
+            {"uint16", ModbusTag::DataType::UInt16}, {"int16", ModbusTag::DataType::Int16},
+            {"uint32", ModbusTag::DataType::UInt32}, {"int32", ModbusTag::DataType::Int32},
+            {"float32", ModbusTag::DataType::Float32}, {"float", ModbusTag::DataType::Float32}
+        };
+        auto it = dataTypes.constFind(dataType.toLower());
+        if (it == dataTypes.constEnd()) this->addError(location, QString("未知的数据类型 \"%1\"").arg(dataType));
+        else tag.dataType = it.value();
+    }
+    const QString byteOrder = fields.value("byteOrder").trimmed();
+    if (!byteOrder.isEmpty())
+    {
+        static const QHash<QString, ModbusTag::ByteOrder> byteOrders = {
+            {"ABCD", ModbusTag::ByteOrder::BigEndian}, {"DCBA", ModbusTag::ByteOrder::LittleEndian},
+            {"BADC", ModbusTag::ByteOrder::BigEndianByteSwap}, {"CDAB", ModbusTag::ByteOrder::LittleEndianByteSwap}
+        };
+        auto it = byteOrders.constFind(byteOrder.toUpper());
+        if (it == byteOrders.constEnd())
+            this->addError(location, QString("未知的字节序 \"%1\"，应为ABCD/DCBA/BADC/CDAB").arg(byteOrder));
+        else tag.byteOrder = it.value();
+    }
+    const QString priority = fields.value("scanPriority").trimmed();
+    static const QStringList priorityNames = {"低", "中", "高"};
+    if (priorityNames.contains(priority)) tag.scanPriority = priorityNames.indexOf(priority);
+    else parseInt("scanPriority", 0, 2, tag.scanPriority);
+
+    if (m_errorCount != errorCount) return false;
+    // 字段之间的约束：地址必须落在功能码对应的数据区内，位数据只能是单个位
+    const int base = ModbusUtils::addressBase(tag.functionCode);
+    const int protocolAddress = tag.address - base;
+    if (protocolAddress < 0 || protocolAddress + ModbusUtils::registerCount(tag) - 1 > 65535)
+    {
+        this->addError(location, QString("地址 %1 不在功能码 %2 的数据区内(从 %3 开始)")
+                       .arg(tag.address).arg(tag.functionCode).arg(base));
+        return false;
+    }
+    if (ModbusUtils::isBitFunction(tag.functionCode) && tag.dataType != ModbusTag::DataType::UInt16)
+    {
+        this->addError(location, "线圈和离散输入只能使用UInt16数据类型");
+        return false;
+    }
+    return true;
+}
+
+void ModbusTagFile::addError(const QString& location, const QString& reason)
+{
+    // 只保留前若干条错误的详细信息，出错的文件可能每一行都有问题
+    ++m_errorCount;
+    if (m_errors.size() < MAX_REPORTED_ERRORS) m_errors.append(QString("%1: %2").arg(location, reason));
+}
+
+QStringList ModbusTagFile::splitCsvLine(const QString& line, bool* ok)
+{
+    // 支持双引号包围的字段，字段内的""表示一个双引号
+    QStringList fields;
+    QString field;
+    bool inQuotes = false;
+    for (int i = 0; i < line.size(); ++i)
+    {
+        const QChar ch = line[i];
+        if (inQuotes)
+        {
+            if (ch != '"') field += ch;
+            else if (i + 1 < line.size() && line[i + 1] == '"') field += line[++i];
+            else inQuotes = false;
+        }
+        else if (ch == '"')
+        {
+            inQuotes = true;
+        }
+        else if (ch == ',')
+        {
+            fields.append(field);
+            field.clear();
+        }
+        else
+        {
+            field += ch;
+        }
+    }
+    fields.append(field);
+    *ok = !inQuotes;
+    return fields;
+}
+
+QString ModbusTagFile::quoteCsvField(const QString& field)
+{
+    if (!field.contains(',') && !field.contains('"') && !field.contains('\n')) return field;
+    QString quoted = field;
+    quoted.replace("\"", "\"\"");
+    return "\"" + quoted + "\"";
+}
+
+QString ModbusTagFile::dataTypeName(ModbusTag::DataType dataType)
+{
+    switch (dataType)
+    {
+    case ModbusTag::DataType::Int16: return "Int16";
+    case ModbusTag::DataType::UInt32: return "UInt32";
+    case ModbusTag::DataType::Int32: return "Int32";
+    case ModbusTag::DataType::Float32: return "Float32";
+    default: return "UInt16";
+    }
+}
+
+QString ModbusTagFile::byteOrderName(ModbusTag::ByteOrder byteOrder)
+{
+    switch (byteOrder)
+    {
+    case ModbusTag::ByteOrder::LittleEndian: return "DCBA";
+    case ModbusTag::ByteOrder::BigEndianByteSwap: return "BADC";
+    case ModbusTag::ByteOrder::LittleEndianByteSwap: return "CDAB";
+    default: return "ABCD";
+    }
+}
+
+QHash<QString, QString> ModbusTagFile::tagFields(const ModbusTag& tag)
+{
+    return {
+        {"name", tag.name},
+        {"slaveId", QString::number(tag.slaveId)},
+        {"functionCode", QString::number(tag.functionCode)},
+        {"address", QString::number(tag.address)},
+        {"dataType", dataTypeName(tag.dataType)},
+        {"byteOrder", byteOrderName(tag.byteOrder)},
+        {"gain", QString::number(tag.gain, 'g', QLocale::FloatingPointShortest)},
+        {"offset", QString::number(tag.offset, 'g', QLocale::FloatingPointShortest)},
+        {"scanInterval", QString::number(tag.scanInterval)},
+        {"scanPriority", QString::number(tag.scanPriority)},
+        {"channelId", tag.channelId}
+    };
+}
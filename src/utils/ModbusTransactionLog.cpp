@@ -0,0 +1,100 @@
+/**
+  ******************************************************************************
+  * @file           : ModbusTransactionLog.cpp
+  * @author         : wangxiangyu
+  * @brief          : Modbus事务记录环形存储的实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/ModbusTransactionLog.h"
+
+ModbusTransactionLog::ModbusTransactionLog(int capacity) : m_capacity(qMax(1, capacity))
+{
+}
+
+void ModbusTransactionLog::append(const ModbusTransactionRecord& record)
+{
+    // 未写满时顺序追加，写满后覆盖最旧的记录，不再分配内存
+    if (m_records.size() < m_capacity)
+    {
+        m_records.append(record);
+    }
+    else
+    {
+        m_records[m_head] = record;
+        m_head = (m_head + 1) % m_capacity;
+    }
+    ++m_totalCount;
+    count(m_slaveCounters[record.slaveId], record);
+    count(m_totalCounters, record);
+}
+
+void ModbusTransactionLog::clear()
+{
+    m_records.clear();
+    m_slaveCounters.clear();
+    m_totalCounters = ModbusTransactionCounters();
+    m_head = 0;
+    m_totalCount = 0;
+}
+
+const ModbusTransactionRecord& ModbusTransactionLog::at(int index) const
+{
+    return m_records[(m_head + index) % m_records.size()];
+}
+
+int ModbusTransactionLog::size() const
+{
+    return m_records.size();
+}
+
+int ModbusTransactionLog::capacity() const
+{
+    return m_capacity;
+}
+
+quint64 ModbusTransactionLog::getTotalCount() const
+{
+    return m_totalCount;
+}
+
+ModbusTransactionCounters ModbusTransactionLog::getCounters(int slaveId) const
+{
+    return m_slaveCounters.value(slaveId);
+}
+
+ModbusTransactionCounters ModbusTransactionLog::getTotalCounters() const
+{
+    return m_totalCounters;
+}
+
+QList<int> ModbusTransactionLog::getSlaveIds() const
+{
+    return m_slaveCounters.keys();
+}
+
+void ModbusTransactionLog::count(ModbusTransactionCounters& counters, const ModbusTransactionRecord& record)
+{
+    switch (record.result)
+    {
+    case ModbusTransactionRecord::Result::Success:
+        ++counters.successCount;
+        break;
+    case ModbusTransactionRecord::Result::Exception:
+        ++counters.exceptionCount;
+        break;
+    case ModbusTransactionRecord::Result::InvalidResponse:
+        ++counters.invalidResponseCount;
+        break;
+    case ModbusTransactionRecord::Result::Timeout:
+        ++counters.timeoutCount;
+        break;
+    case ModbusTransactionRecord::Result::CrcError:
+        // 校验失败的帧不对应新的请求，该请求的结果另有一条超时记录
+        ++counters.crcErrorCount;
+        return;
+    }
+    if (record.isFinal) ++counters.requestCount;
+}
@@ -58,3 +58,140 @@ QVariant ModbusUtils::interpretRaw32BitValue(quint32 rawValue, ModbusTag::DataTy
         return QVariant();
     }
 }
+
+int ModbusUtils::addressBase(int functionCode)
+{
+    switch (functionCode)
+    {
+    case 0x01:
+    case 0x05:
+    case 0x0F:
+        return 1;
+    case 0x02:
+        return 10001;
+    case 0x04:
+        return 30001;
+    default:
+        return 40001;
+    }
+}
+
+bool ModbusUtils::isBitFunction(int functionCode)
+{
+    return functionCode == 0x01 || functionCode == 0x02 || functionCode == 0x05 || functionCode == 0x0F;
+}
+
+int ModbusUtils::registerCount(const ModbusTag& tag)
+{
+    if (isBitFunction(tag.functionCode)) return 1;
+    return (tag.dataType == ModbusTag::DataType::Float32
+               || tag.dataType == ModbusTag::DataType::Int32
+               || tag.dataType == ModbusTag::DataType::UInt32)
+               ? 2
+               : 1;
+}
+
+int ModbusUtils::maxReadQuantity(int functionCode)
+{
+    return isBitFunction(functionCode) ? 2000 : 125;
+}
+
+ModbusLinkTiming ModbusUtils::serialLinkTiming(const QSerialPort* port)
+{
+    // 每个字符：起始位 + 数据位 + 校验位 + 停止位
+    const int baudRate = port && port->baudRate() > 0 ? port->baudRate() : 9600;
+    double charBits = 1 + (port && port->dataBits() > 0 ? port->dataBits() : 8);
+    if (port && port->parity() != QSerialPort::NoParity) charBits += 1;
+    if (port && port->stopBits() == QSerialPort::TwoStop) charBits += 2;
+    else if (port && port->stopBits() == QSerialPort::OneAndHalfStop) charBits += 1.5;
+    else charBits += 1;
+    ModbusLinkTiming timing;
+    timing.byteTime = charBits * 1000.0 / baudRate;
+    // 协议规定帧间至少3.5个字符的静默，波特率高于19200时固定为1.75ms
+    timing.frameGap = baudRate > 19200 ? 1.75 : 3.5 * timing.byteTime;
+    return timing;
+}
+
+int ModbusUtils::rtuResponseSize(int functionCode, int quantity)
+{
+    // 读响应：从站 + 功能码 + 字节数 + 数据 + CRC；写响应回显地址和数量/值
+    switch (functionCode)
+    {
+        case 0x01:
+        case 0x02:
+            return 5 + (quantity + 7) / 8;
+        case 0x03:
+        case 0x04:
+        case 0x17:
+            return 5 + quantity * 2;
+        default:
+            return 8;
+    }
+}
+
+QList<quint16> ModbusUtils::unpackBits(const char* data, int count)
+{
+    QList<quint16> values;
+    values.reserve(count);
+    for (int i = 0; i < count; ++i) values.append((static_cast<quint8>(data[i / 8]) >> (i % 8)) & 0x01);
+    return values;
+}
+
+QList<quint16> ModbusUtils::unpackRegisters(const char* data, int count)
+{
+    QList<quint16> values;
+    values.reserve(count);
+    for (int i = 0; i < count; ++i)
+        values.append((static_cast<quint8>(data[2 * i]) << 8) | static_cast<quint8>(data[2 * i + 1]));
+    return values;
+}
+
+ModbusDecodeEntry ModbusUtils::compileDecodeEntry(const ModbusTag& tag, int tagIndex, int offset)
+{
+    ModbusDecodeEntry entry;
+    entry.tagIndex = tagIndex;
+    entry.offset = offset;
+    entry.width = registerCount(tag);
+    entry.isBit = isBitFunction(tag.functionCode);
+    entry.dataType = tag.dataType;
+    entry.byteOrder = tag.byteOrder;
+    // 线圈和离散输入只有0/1，不做换算
+    entry.gain = entry.isBit ? 1.0 : tag.gain;
+    entry.valueOffset = entry.isBit ? 0.0 : tag.offset;
+    return entry;
+}
+
+bool ModbusUtils::decodeValue(const ModbusDecodeEntry& entry, const QList<quint16>& values, double& value,
+                              quint32& rawValue)
+{
+    if (entry.offset < 0 || entry.offset + entry.width > values.size()) return false;
+    double engineeringValue = 0.0;
+    if (entry.width == 2)
+    {
+        // 低地址寄存器在前，按字节序重新组合
+        rawValue = reassemble32BitValue(values[entry.offset], values[entry.offset + 1], entry.byteOrder);
+        if (entry.dataType == ModbusTag::DataType::Float32)
+        {
+            float floatValue;
+            std::memcpy(&floatValue, &rawValue, sizeof(float));
+            engineeringValue = floatValue;
+        }
+        else if (entry.dataType == ModbusTag::DataType::Int32)
+        {
+            engineeringValue = static_cast<qint32>(rawValue);
+        }
+        else
+        {
+            engineeringValue = rawValue;
+        }
+    }
+    else
+    {
+        rawValue = values[entry.offset];
+        engineeringValue = entry.dataType == ModbusTag::DataType::Int16 && !entry.isBit
+                               ? static_cast<qint16>(rawValue)
+                               : rawValue;
+    }
+    value = engineeringValue * entry.gain + entry.valueOffset; // 应用增益和偏移
+    return true;
+}
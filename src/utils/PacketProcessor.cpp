@@ -31,6 +31,13 @@ void PacketProcessor::enqueueData(const DataPacket& packet)
     m_condition.wakeOne();
 }
 
+void PacketProcessor::publishWaveformBlock(const QString& channelName, const QVector<double>& timestamps,
+                                           const QVector<double>& values)
+{
+    // 波形窗口以队列连接接收该信号，从调用线程直接发出即可
+    emit waveformBlockReady(channelName, timestamps, values);
+}
+
 void PacketProcessor::run()
 {
     while (!m_quit)
@@ -85,6 +92,7 @@ PacketProcessor::~PacketProcessor()
 
 void PacketProcessor::processSerialData(const DataPacket& packet)
 {
+    emit serialPortRawDataReceived(packet);
     // 判断是否使用用户脚本处理数据
     if (ScriptManager::getInstance()->isEnableSerialPortScript()) this->processSerialDataWithScript(packet);
     else this->processSerialDataWithoutScript(packet);
@@ -116,7 +124,6 @@ void PacketProcessor::processSerialDataWithScript(const DataPacket& packet)
     ChannelManager* chManager = ChannelManager::getInstance();
     const bool isRecording = chManager->isDataRecordingEnabled();
     const QList<ChannelInfo> activeChannels = chManager->getAllChannels();
-    const double sampleRate = chManager->getSampleRate();
     const bool isHex = SerialPortManager::getInstance()->isHexDisplayEnabled();
     const bool isTimestamp = SerialPortManager::getInstance()->isTimestampEnabled();
 
@@ -127,6 +134,7 @@ void PacketProcessor::processSerialDataWithScript(const DataPacket& packet)
         idToNameMap[ch.id] = ch.name;
         activeChannelIds.insert(ch.id);
     }
+    QHash<QString, WaveformBlock> waveformBlocks;
     // 遍历脚本返回的所有已解析帧
     const int framesCount = framesArray.property("length").toInt();
     for (int i = 0; i < framesCount; ++i)
@@ -163,14 +171,11 @@ void PacketProcessor::processSerialDataWithScript(const DataPacket& packet)
             if (activeChannelIds.contains(channelId))
             {
                 double value = chartObj.value("point").toDouble();
-                QString channelName = idToNameMap.value(channelId);
-                if (!m_channelTimestamps.contains(channelId)) m_channelTimestamps[channelId] = 0;
-                double currentTime = m_channelTimestamps[channelId];
-                m_channelTimestamps[channelId] += sampleRate;
-                emit waveformDataReady(channelName, QVariantList{currentTime, value});
+                this->appendWaveformPoint(waveformBlocks, channelId, idToNameMap.value(channelId), value);
             }
         }
     }
+    this->flushWaveformBlocks(waveformBlocks);
 }
 
 void PacketProcessor::processSerialDataWithoutScript(const DataPacket& packet)
@@ -205,7 +210,6 @@ void PacketProcessor::processSerialDataWithoutScript(const DataPacket& packet)
     m_serialWaveformBuffer = m_serialWaveformBuffer.mid(lastSeparator + 1);
     ChannelManager* chManager = ChannelManager::getInstance();
     const QList<ChannelInfo> activeChannels = chManager->getAllChannels();
-    const double sampleRate = chManager->getSampleRate();
     QHash<QString, QString> idToNameMap;
     QSet<QString> activeChannelIds;
     for (const auto& ch : activeChannels)
@@ -213,6 +217,7 @@ void PacketProcessor::processSerialDataWithoutScript(const DataPacket& packet)
         idToNameMap[ch.id] = ch.name;
         activeChannelIds.insert(ch.id);
     }
+    QHash<QString, WaveformBlock> waveformBlocks;
     QList<QByteArray> points = completeFrames.split(',');
     for (const QByteArray& dataPoint : points)
     {
@@ -220,17 +225,29 @@ void PacketProcessor::processSerialDataWithoutScript(const DataPacket& packet)
         if (eqPos == -1) continue;
         QString channelId = QString::fromLatin1(dataPoint.left(eqPos).trimmed());
         if (!activeChannelIds.contains(channelId)) continue;
-        QString channelName = idToNameMap.value(channelId);
         bool ok;
         double value = dataPoint.mid(eqPos + 1).trimmed().toDouble(&ok);
         if (!ok) continue;
-        if (!m_channelTimestamps.contains(channelId)) m_channelTimestamps[channelId] = 0;
-        double currentTime = m_channelTimestamps[channelId];
-        m_channelTimestamps[channelId] += sampleRate;
-        QVariantList point;
-        point << currentTime << value;
-        emit waveformDataReady(channelName, point);
+        this->appendWaveformPoint(waveformBlocks, channelId, idToNameMap.value(channelId), value);
     }
+    this->flushWaveformBlocks(waveformBlocks);
+}
+
+void PacketProcessor::appendWaveformPoint(QHash<QString, WaveformBlock>& blocks, const QString& channelId,
+                                          const QString& channelName, double value)
+{
+    double& timestamp = m_channelTimestamps[channelId];
+    WaveformBlock& block = blocks[channelName];
+    block.timestamps.append(timestamp);
+    block.values.append(value);
+    timestamp += ChannelManager::getInstance()->getSampleRate();
+}
+
+void PacketProcessor::flushWaveformBlocks(QHash<QString, WaveformBlock>& blocks)
+{
+    for (auto it = blocks.cbegin(); it != blocks.cend(); ++it)
+        emit waveformBlockReady(it.key(), it->timestamps, it->values);
+    blocks.clear();
 }
 
 void PacketProcessor::processTcpData(const DataPacket& packet)
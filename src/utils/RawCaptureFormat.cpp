@@ -0,0 +1,137 @@
+/**
+  ******************************************************************************
+  * @file           : RawCaptureFormat.cpp
+  * @author         : wangxiangyu
+  * @brief          : 原始字节捕获文件格式实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/RawCaptureFormat.h"
+#include "utils/MappedCaptureWriter.h"
+#include <QtEndian>
+#include <cstring>
+#include <limits>
+
+QByteArray RawCapture::encodeFileHeader()
+{
+    QByteArray header(FILE_HEADER_SIZE, Qt::Uninitialized);
+    memcpy(header.data(), FILE_MAGIC, sizeof(FILE_MAGIC));
+    qToLittleEndian<quint16>(FILE_VERSION, header.data() + sizeof(FILE_MAGIC));
+    return header;
+}
+
+void RawCapture::appendRecord(QByteArray& out, Direction direction, qint64 timestamp, const QString& source,
+                              const QByteArray& data)
+{
+    // 来源最长255字节，串口名和IP:端口都远小于该长度
+    const QByteArray sourceBytes = source.toUtf8().left(255);
+    const qsizetype offset = out.size();
+    out.resize(offset + RECORD_HEADER_SIZE + sourceBytes.size() + data.size());
+    char* p = out.data() + offset;
+    p[0] = static_cast<char>(direction);
+    p[1] = static_cast<char>(sourceBytes.size());
+    qToLittleEndian<qint64>(timestamp, p + 2);
+    qToLittleEndian<quint32>(static_cast<quint32>(data.size()), p + 10);
+    p += RECORD_HEADER_SIZE;
+    memcpy(p, sourceBytes.constData(), sourceBytes.size());
+    memcpy(p + sourceBytes.size(), data.constData(), data.size());
+}
+
+QByteArray RawCapture::encodeRecord(Direction direction, qint64 timestamp, const QString& source,
+                                    const QByteArray& data)
+{
+    QByteArray out;
+    out.reserve(RECORD_HEADER_SIZE + source.size() + data.size());
+    appendRecord(out, direction, timestamp, source, data);
+    return out;
+}
+
+qint64 RawCapture::readFileHeader(QIODevice& device, QString& errorString)
+{
+    qint64 dataEnd = device.isSequential() ? std::numeric_limits<qint64>::max() : device.size();
+    // 映射方式写入的文件外层还有一个文件头，已提交长度之后是预分配的空白区域
+    if (device.peek(sizeof(MappedCaptureWriter::FILE_MAGIC)) ==
+        QByteArray::fromRawData(MappedCaptureWriter::FILE_MAGIC, sizeof(MappedCaptureWriter::FILE_MAGIC)))
+    {
+        const qint64 committedLength = MappedCaptureWriter::readCommittedLength(device);
+        if (committedLength < 0)
+        {
+            errorString = QString("映射捕获文件头无效");
+            return -1;
+        }
+        dataEnd = qMin(dataEnd, device.pos() + committedLength);
+    }
+    const QByteArray header = device.read(FILE_HEADER_SIZE);
+    if (header.size() != FILE_HEADER_SIZE || memcmp(header.constData(), FILE_MAGIC, sizeof(FILE_MAGIC)) != 0)
+    {
+        errorString = QString("不是有效的原始数据捕获文件");
+        return -1;
+    }
+    const quint16 version = qFromLittleEndian<quint16>(header.constData() + sizeof(FILE_MAGIC));
+    if (version != FILE_VERSION)
+    {
+        errorString = QString("不支持的捕获文件版本：%1").arg(version);
+        return -1;
+    }
+    if (device.pos() > dataEnd)
+    {
+        errorString = QString("捕获文件不完整");
+        return -1;
+    }
+    return dataEnd;
+}
+
+bool RawCapture::readRecord(QIODevice& device, Record& record, qint64 dataEnd)
+{
+    if (dataEnd - device.pos() < RECORD_HEADER_SIZE) return false;
+    char header[RECORD_HEADER_SIZE];
+    if (device.read(header, RECORD_HEADER_SIZE) != RECORD_HEADER_SIZE) return false;
+    const quint8 direction = static_cast<quint8>(header[0]);
+    if (direction > static_cast<quint8>(Direction::Send)) return false;
+    const int sourceSize = static_cast<quint8>(header[1]);
+    const quint32 dataSize = qFromLittleEndian<quint32>(header + 10);
+    // 记录超出已提交范围说明写入时被中断
+    if (dataEnd - device.pos() < static_cast<qint64>(sourceSize) + dataSize) return false;
+    const QByteArray sourceBytes = device.read(sourceSize);
+    if (sourceBytes.size() != sourceSize) return false;
+    record.data = device.read(dataSize);
+    if (record.data.size() != static_cast<qsizetype>(dataSize)) return false;
+    record.direction = static_cast<Direction>(direction);
+    record.timestamp = qFromLittleEndian<qint64>(header + 2);
+    record.source = QString::fromUtf8(sourceBytes);
+    return true;
+}
+
+RawCapture::Reader::Reader(const QString& fileName)
+    : m_file(fileName)
+{
+}
+
+bool RawCapture::Reader::open()
+{
+    // 只读打开，不恢复文件，正在写入的捕获文件也可以安全读取
+    if (!m_file.open(QIODevice::ReadOnly))
+    {
+        m_errorString = m_file.errorString();
+        return false;
+    }
+    m_dataEnd = readFileHeader(m_file, m_errorString);
+    if (m_dataEnd < 0)
+    {
+        m_file.close();
+        return false;
+    }
+    return true;
+}
+
+bool RawCapture::Reader::readNext(Record& record)
+{
+    return m_file.isOpen() && readRecord(m_file, record, m_dataEnd);
+}
+
+QString RawCapture::Reader::errorString() const
+{
+    return m_errorString;
+}
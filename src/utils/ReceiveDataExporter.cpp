@@ -0,0 +1,66 @@
+/**
+  ******************************************************************************
+  * @file           : ReceiveDataExporter.cpp
+  * @author         : wangxiangyu
+  * @brief          : 接收区数据流式保存实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/ReceiveDataExporter.h"
+
+// 构造函数和析构函数
+ReceiveDataExporter::ReceiveDataExporter(const QString& fileName, const ReceiveRecordFilter& filter, QObject* parent)
+    : QObject(parent), m_fileName(fileName), m_reader(ReceiveRecordStore::getInstance()->snapshot(), filter)
+{
+}
+
+void ReceiveDataExporter::run()
+{
+    QFile file(m_fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        emit finished(false, QString("无法打开文件：%1").arg(file.errorString()));
+        return;
+    }
+    const qint64 totalBytes = qMax<qint64>(1, m_reader.getTotalBytes());
+    int lastPercent = -1;
+    bool ok = true;
+    while (!m_reader.atEnd() && !m_cancelled.load())
+    {
+        const QByteArray chunk = m_reader.readChunk(WRITE_CHUNK_SIZE);
+        if (!chunk.isEmpty() && file.write(chunk) != chunk.size())
+        {
+            ok = false;
+            break;
+        }
+        const int percent = static_cast<int>(m_reader.getProcessedBytes() * 100 / totalBytes);
+        if (percent != lastPercent)
+        {
+            lastPercent = percent;
+            emit progressChanged(percent);
+        }
+    }
+    const QString error = file.errorString();
+    file.close();
+    if (m_cancelled.load())
+    {
+        file.remove();
+        emit finished(false, "保存已取消");
+        return;
+    }
+    if (!ok)
+    {
+        file.remove();
+        emit finished(false, QString("保存失败：%1").arg(error));
+        return;
+    }
+    emit progressChanged(100);
+    emit finished(true, QString("已保存 %1 行数据至%2").arg(m_reader.getMatchedRecords()).arg(m_fileName));
+}
+
+void ReceiveDataExporter::cancel()
+{
+    m_cancelled.store(true);
+}
@@ -0,0 +1,146 @@
+/**
+  ******************************************************************************
+  * @file           : ReceiveRecordStore.cpp
+  * @author         : wangxiangyu
+  * @brief          : 接收区数据记录存储实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/ReceiveRecordStore.h"
+#include <QDateTime>
+
+// 静态成员变量
+ReceiveRecordStore* ReceiveRecordStore::m_pInstance = nullptr;
+QMutex ReceiveRecordStore::m_instanceMutex;
+
+ReceiveRecordStore* ReceiveRecordStore::getInstance()
+{
+    if (m_pInstance == nullptr)
+    {
+        QMutexLocker locker(&m_instanceMutex);
+        if (m_pInstance == nullptr) m_pInstance = new ReceiveRecordStore;
+    }
+    return m_pInstance;
+}
+
+void ReceiveRecordStore::append(const QString& text, bool isSent)
+{
+    const QByteArray utf8 = text.toUtf8();
+    const qint64 timestamp = QDateTime::currentMSecsSinceEpoch();
+    QMutexLocker locker(&m_mutex);
+    if (!m_currentChunk.text.isEmpty() && m_currentChunk.text.size() + utf8.size() > CHUNK_SIZE)
+        this->sealCurrentChunk();
+    RecordIndex record;
+    record.timestamp = timestamp;
+    record.offset = static_cast<qint32>(m_currentChunk.text.size());
+    record.length = static_cast<qint32>(utf8.size());
+    record.isSent = isSent;
+    m_currentChunk.text.append(utf8);
+    m_currentChunk.records.append(record);
+    if (m_recordCount == 0) m_firstTimestamp = timestamp;
+    m_lastTimestamp = timestamp;
+    ++m_recordCount;
+    m_byteCount += utf8.size() + 1;
+}
+
+void ReceiveRecordStore::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_sealedChunks.clear();
+    m_currentChunk = Chunk();
+    m_recordCount = 0;
+    m_byteCount = 0;
+    m_firstTimestamp = 0;
+    m_lastTimestamp = 0;
+}
+
+ReceiveRecordStore::Snapshot ReceiveRecordStore::snapshot() const
+{
+    QMutexLocker locker(&m_mutex);
+    Snapshot snapshot;
+    snapshot.chunks = m_sealedChunks;
+    // 只有未写满的当前块需要复制，最多CHUNK_SIZE字节
+    if (!m_currentChunk.records.isEmpty()) snapshot.chunks.append(std::make_shared<const Chunk>(m_currentChunk));
+    snapshot.recordCount = m_recordCount;
+    snapshot.byteCount = m_byteCount;
+    snapshot.firstTimestamp = m_firstTimestamp;
+    snapshot.lastTimestamp = m_lastTimestamp;
+    return snapshot;
+}
+
+qint64 ReceiveRecordStore::getByteCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_byteCount;
+}
+
+// 私有方法
+void ReceiveRecordStore::sealCurrentChunk()
+{
+    m_sealedChunks.append(std::make_shared<const Chunk>(std::move(m_currentChunk)));
+    m_currentChunk = Chunk();
+    m_currentChunk.text.reserve(CHUNK_SIZE);
+}
+
+// Reader
+ReceiveRecordStore::Reader::Reader(Snapshot snapshot, ReceiveRecordFilter filter)
+    : m_snapshot(std::move(snapshot)), m_filter(std::move(filter)), m_keyword(m_filter.keyword.toUtf8())
+{
+}
+
+bool ReceiveRecordStore::Reader::atEnd() const
+{
+    return m_chunkIndex >= m_snapshot.chunks.size();
+}
+
+QByteArray ReceiveRecordStore::Reader::readChunk(qint64 maxBytes)
+{
+    QByteArray out;
+    out.reserve(maxBytes + 4096);
+    while (!this->atEnd())
+    {
+        const Chunk& chunk = *m_snapshot.chunks[m_chunkIndex];
+        if (m_recordIndex >= chunk.records.size())
+        {
+            ++m_chunkIndex;
+            m_recordIndex = 0;
+            continue;
+        }
+        const RecordIndex& record = chunk.records[m_recordIndex];
+        if (!out.isEmpty() && out.size() + record.length + 1 > maxBytes) break;
+        ++m_recordIndex;
+        m_processedBytes += record.length + 1;
+        if (!this->matches(chunk, record)) continue;
+        out.append(chunk.text.constData() + record.offset, record.length).append('\n');
+        ++m_matchedRecords;
+    }
+    return out;
+}
+
+qint64 ReceiveRecordStore::Reader::getProcessedBytes() const
+{
+    return m_processedBytes;
+}
+
+qint64 ReceiveRecordStore::Reader::getTotalBytes() const
+{
+    return m_snapshot.byteCount;
+}
+
+qint64 ReceiveRecordStore::Reader::getMatchedRecords() const
+{
+    return m_matchedRecords;
+}
+
+bool ReceiveRecordStore::Reader::matches(const Chunk& chunk, const RecordIndex& record) const
+{
+    if (m_filter.startTime > 0 && record.timestamp < m_filter.startTime) return false;
+    if (m_filter.endTime > 0 && record.timestamp > m_filter.endTime) return false;
+    if (m_keyword.isEmpty()) return true;
+    const QByteArrayView line(chunk.text.constData() + record.offset, record.length);
+    // 区分大小写时直接按字节查找，避免逐行转换为QString
+    if (m_filter.caseSensitivity == Qt::CaseSensitive) return line.indexOf(m_keyword) >= 0;
+    return QString::fromUtf8(line).contains(m_filter.keyword, Qt::CaseInsensitive);
+}
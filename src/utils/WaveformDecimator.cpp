@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file           : WaveformDecimator.cpp
+  * @author         : wangxiangyu
+  * @brief          : 波形数据抽取实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/WaveformDecimator.h"
+#include <cmath>
+
+// WaveformPyramid
+void WaveformPyramid::append(double timestamp, double value)
+{
+    if (m_levels.isEmpty()) m_levels.resize(MAX_LEVELS);
+    for (int level = 0; level < MAX_LEVELS; ++level)
+    {
+        const qsizetype bucketIndex = m_sampleCount / getBucketSize(level);
+        QVector<WaveformBucket>& buckets = m_levels[level];
+        if (bucketIndex >= buckets.size())
+        {
+            WaveformBucket bucket;
+            bucket.startTime = bucket.endTime = timestamp;
+            bucket.minValue = bucket.maxValue = bucket.firstValue = bucket.lastValue = value;
+            buckets.append(bucket);
+            continue;
+        }
+        WaveformBucket& bucket = buckets[bucketIndex];
+        bucket.endTime = timestamp;
+        if (value < bucket.minValue) bucket.minValue = value;
+        if (value > bucket.maxValue) bucket.maxValue = value;
+        bucket.lastValue = value;
+    }
+    ++m_sampleCount;
+}
+
+void WaveformPyramid::clear()
+{
+    m_levels.clear();
+    m_sampleCount = 0;
+}
+
+qsizetype WaveformPyramid::getBucketSize(int level)
+{
+    qsizetype size = BASE_BUCKET_SIZE;
+    for (int i = 0; i < level; ++i) size *= FANOUT;
+    return size;
+}
+
+int WaveformPyramid::selectLevel(qsizetype maxBucketSize) const
+{
+    int selected = -1;
+    for (int level = 0; level < m_levels.size(); ++level)
+    {
+        if (getBucketSize(level) > maxBucketSize) break;
+        selected = level;
+    }
+    return selected;
+}
+
+// WaveformDecimator
+void WaveformDecimator::lttb(const double* timestamps, const double* values, qsizetype count, qsizetype threshold,
+                             QVector<double>& outTimestamps, QVector<double>& outValues)
+{
+    outTimestamps.clear();
+    outValues.clear();
+    if (count <= 0) return;
+    if (threshold >= count || threshold < 3)
+    {
+        outTimestamps.assign(timestamps, timestamps + count);
+        outValues.assign(values, values + count);
+        return;
+    }
+    outTimestamps.reserve(threshold);
+    outValues.reserve(threshold);
+    // 首尾点固定保留，中间的点平均分成threshold-2个桶
+    const double bucketSize = static_cast<double>(count - 2) / (threshold - 2);
+    qsizetype selected = 0;
+    outTimestamps.append(timestamps[0]);
+    outValues.append(values[0]);
+    for (qsizetype bucket = 0; bucket < threshold - 2; ++bucket)
+    {
+        // 下一个桶的均值点作为三角形的第三个顶点
+        qsizetype nextStart = static_cast<qsizetype>(std::floor((bucket + 1) * bucketSize)) + 1;
+        qsizetype nextEnd = qMin(static_cast<qsizetype>(std::floor((bucket + 2) * bucketSize)) + 1, count);
+        if (nextStart >= nextEnd) nextStart = nextEnd - 1;
+        double avgTime = 0.0, avgValue = 0.0;
+        for (qsizetype i = nextStart; i < nextEnd; ++i)
+        {
+            avgTime += timestamps[i];
+            avgValue += values[i];
+        }
+        avgTime /= (nextEnd - nextStart);
+        avgValue /= (nextEnd - nextStart);
+        // 在当前桶中选取与上一个选中点、下一桶均值点构成面积最大三角形的点
+        const qsizetype start = static_cast<qsizetype>(std::floor(bucket * bucketSize)) + 1;
+        const qsizetype end = static_cast<qsizetype>(std::floor((bucket + 1) * bucketSize)) + 1;
+        const double pointTime = timestamps[selected];
+        const double pointValue = values[selected];
+        double maxArea = -1.0;
+        qsizetype maxIndex = start;
+        for (qsizetype i = start; i < end; ++i)
+        {
+            double area = std::abs((pointTime - avgTime) * (values[i] - pointValue) -
+                                   (pointTime - timestamps[i]) * (avgValue - pointValue));
+            if (area > maxArea)
+            {
+                maxArea = area;
+                maxIndex = i;
+            }
+        }
+        outTimestamps.append(timestamps[maxIndex]);
+        outValues.append(values[maxIndex]);
+        selected = maxIndex;
+    }
+    outTimestamps.append(timestamps[count - 1]);
+    outValues.append(values[count - 1]);
+}
@@ -0,0 +1,255 @@
+/**
+  ******************************************************************************
+  * @file           : WaveformExporter.cpp
+  * @author         : wangxiangyu
+  * @brief          : 波形数据流式导出实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/WaveformExporter.h"
+#include <QtEndian>
+#include <bit>
+#include <charconv>
+#include <cmath>
+
+// 构造函数和析构函数
+WaveformExporter::WaveformExporter(const QString& fileName, Format format, QObject* parent)
+    : QObject(parent), m_fileName(fileName), m_format(format), m_pStore(WaveformSampleStore::getInstance())
+{
+    // 在调用线程中做快照，保证进度计算的总数稳定
+    m_channelNames = m_pStore->getChannelNames();
+    m_channelNames.sort();
+    for (const QString& name : m_channelNames)
+    {
+        m_sampleCounts.append(m_pStore->getSampleCount(name));
+        m_totalSamples += m_sampleCounts.last();
+    }
+}
+
+void WaveformExporter::run()
+{
+    QFile file(m_fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        emit finished(false, QString("无法打开文件：%1").arg(file.errorString()));
+        return;
+    }
+    m_buffer.reserve(BUFFER_FLUSH_SIZE + 4096);
+    bool ok = false;
+    switch (m_format)
+    {
+    case Format::Csv:
+        ok = this->writeCsv(file);
+        break;
+    case Format::Binary:
+        ok = this->writeBinary(file);
+        break;
+    case Format::Json:
+        ok = this->writeJson(file);
+        break;
+    }
+    ok = ok && this->flushBuffer(file, true);
+    const QString error = m_errorString.isEmpty() ? file.errorString() : m_errorString;
+    file.close();
+    if (m_cancelled.load())
+    {
+        file.remove();
+        emit finished(false, "导出已取消");
+        return;
+    }
+    if (!ok)
+    {
+        file.remove();
+        emit finished(false, QString("导出失败：%1").arg(error));
+        return;
+    }
+    emit progressChanged(100);
+    emit finished(true, QString("已导出 %1 个数据点").arg(m_writtenSamples));
+}
+
+void WaveformExporter::cancel()
+{
+    m_cancelled.store(true);
+}
+
+WaveformExporter::Format WaveformExporter::formatFromFileName(const QString& fileName)
+{
+    if (fileName.endsWith(".csv", Qt::CaseInsensitive)) return Format::Csv;
+    if (fileName.endsWith(".bin", Qt::CaseInsensitive)) return Format::Binary;
+    return Format::Json;
+}
+
+// 私有方法
+bool WaveformExporter::writeCsv(QFile& file)
+{
+    // 长表格式：每行一个数据点，各通道依次输出，便于表格软件按通道筛选
+    m_buffer.append("channel,time_ms,value\n");
+    for (int c = 0; c < m_channelNames.size(); ++c)
+    {
+        const QByteArray channelField = m_channelNames[c].toUtf8() + ',';
+        bool ok = this->forEachChunk(m_channelNames[c], m_sampleCounts[c],
+                                     [&](const QVector<double>& timestamps, const QVector<double>& values)
+                                     {
+                                         for (qsizetype i = 0; i < timestamps.size(); ++i)
+                                         {
+                                             m_buffer.append(channelField);
+                                             appendNumber(m_buffer, timestamps[i]);
+                                             m_buffer.append(',');
+                                             appendNumber(m_buffer, values[i]);
+                                             m_buffer.append('\n');
+                                         }
+                                         return this->flushBuffer(file);
+                                     });
+        if (!ok) return false;
+    }
+    return true;
+}
+
+bool WaveformExporter::writeBinary(QFile& file)
+{
+    auto appendU32 = [this](quint32 value)
+    {
+        value = qToLittleEndian(value);
+        m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    auto appendU64 = [this](quint64 value)
+    {
+        value = qToLittleEndian(value);
+        m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    m_buffer.append(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    appendU32(BINARY_VERSION);
+    appendU32(static_cast<quint32>(m_channelNames.size()));
+    for (int c = 0; c < m_channelNames.size(); ++c)
+    {
+        const QByteArray name = m_channelNames[c].toUtf8();
+        appendU32(static_cast<quint32>(name.size()));
+        m_buffer.append(name);
+        appendU64(static_cast<quint64>(m_sampleCounts[c]));
+        bool ok = this->forEachChunk(m_channelNames[c], m_sampleCounts[c],
+                                     [&](const QVector<double>& timestamps, const QVector<double>& values)
+                                     {
+                                         for (qsizetype i = 0; i < timestamps.size(); ++i)
+                                         {
+                                             appendU64(std::bit_cast<quint64>(timestamps[i]));
+                                             appendU64(std::bit_cast<quint64>(values[i]));
+                                         }
+                                         return this->flushBuffer(file);
+                                     });
+        if (!ok) return false;
+    }
+    return true;
+}
+
+bool WaveformExporter::writeJson(QFile& file)
+{
+    // 与导入格式保持一致：{"通道名":[[t,v],...],...}，逐段写出，不构造完整的QJsonDocument
+    m_buffer.append('{');
+    for (int c = 0; c < m_channelNames.size(); ++c)
+    {
+        if (c > 0) m_buffer.append(',');
+        m_buffer.append('"').append(escapeJsonString(m_channelNames[c])).append("\":[");
+        bool first = true;
+        bool ok = this->forEachChunk(m_channelNames[c], m_sampleCounts[c],
+                                     [&](const QVector<double>& timestamps, const QVector<double>& values)
+                                     {
+                                         for (qsizetype i = 0; i < timestamps.size(); ++i)
+                                         {
+                                             if (!first) m_buffer.append(',');
+                                             first = false;
+                                             m_buffer.append('[');
+                                             appendNumber(m_buffer, timestamps[i], "null");
+                                             m_buffer.append(',');
+                                             appendNumber(m_buffer, values[i], "null");
+                                             m_buffer.append(']');
+                                         }
+                                         return this->flushBuffer(file);
+                                     });
+        if (!ok) return false;
+        m_buffer.append(']');
+    }
+    m_buffer.append('}');
+    return true;
+}
+
+template <typename Func>
+bool WaveformExporter::forEachChunk(const QString& name, qsizetype sampleCount, Func func)
+{
+    QVector<double> timestamps, values;
+    qsizetype index = 0;
+    while (index < sampleCount)
+    {
+        if (m_cancelled.load()) return false;
+        const qsizetype count = m_pStore->readSamples(name, index, qMin(WaveformSampleStore::BLOCK_SIZE,
+                                                                         sampleCount - index), timestamps, values);
+        // 通道在导出过程中被清除，已写出的点数与文件头不一致，按失败处理
+        if (count == 0)
+        {
+            m_errorString = QString("通道 %1 的数据在导出过程中被清除").arg(name);
+            return false;
+        }
+        if (!func(timestamps, values)) return false;
+        index += count;
+        m_writtenSamples += count;
+        this->reportProgress();
+    }
+    return true;
+}
+
+bool WaveformExporter::flushBuffer(QFile& file, bool force)
+{
+    if (!force && m_buffer.size() < BUFFER_FLUSH_SIZE) return true;
+    if (m_buffer.isEmpty()) return true;
+    const bool ok = file.write(m_buffer) == m_buffer.size();
+    m_buffer.resize(0); // 保留已分配的容量
+    return ok;
+}
+
+void WaveformExporter::reportProgress()
+{
+    if (m_totalSamples <= 0) return;
+    const int percent = static_cast<int>(m_writtenSamples * 100 / m_totalSamples);
+    if (percent == m_lastPercent) return;
+    m_lastPercent = percent;
+    emit progressChanged(percent);
+}
+
+void WaveformExporter::appendNumber(QByteArray& buffer, double value, const char* nonFiniteText)
+{
+    if (!std::isfinite(value))
+    {
+        buffer.append(nonFiniteText);
+        return;
+    }
+    // std::to_chars输出最短且可精确还原的表示，比QByteArray::number快得多
+    char text[32];
+    auto result = std::to_chars(text, text + sizeof(text), value);
+    buffer.append(text, result.ptr - text);
+}
+
+QByteArray WaveformExporter::escapeJsonString(const QString& text)
+{
+    // 除引号和反斜杠外，U+0000~U+001F的控制字符也必须转义
+    QString escaped;
+    escaped.reserve(text.size());
+    for (const QChar ch : text)
+    {
+        switch (ch.unicode())
+        {
+        case '"': escaped += "\\\""; break;
+        case '\\': escaped += "\\\\"; break;
+        case '\b': escaped += "\\b"; break;
+        case '\f': escaped += "\\f"; break;
+        case '\n': escaped += "\\n"; break;
+        case '\r': escaped += "\\r"; break;
+        case '\t': escaped += "\\t"; break;
+        default:
+            if (ch.unicode() < 0x20) escaped += QString("\\u%1").arg(ch.unicode(), 4, 16, QChar('0'));
+            else escaped += ch;
+            break;
+        }
+    }
+    return escaped.toUtf8();
+}
@@ -0,0 +1,454 @@
+/**
+  ******************************************************************************
+  * @file           : WaveformImporter.cpp
+  * @author         : wangxiangyu
+  * @brief          : 波形数据流式导入实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/WaveformImporter.h"
+#include <QtEndian>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// 构造函数和析构函数
+WaveformImporter::WaveformImporter(const QString& fileName, WaveformExporter::Format format, QObject* parent)
+    : QObject(parent), m_fileName(fileName), m_format(format), m_pStore(WaveformSampleStore::getInstance())
+{
+}
+
+void WaveformImporter::run()
+{
+    QFile file(m_fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        emit finished(false, QString("无法打开文件：%1").arg(file.errorString()));
+        return;
+    }
+    m_fileSize = file.size();
+    bool ok = false;
+    switch (m_format)
+    {
+    case WaveformExporter::Format::Csv:
+        ok = this->readCsv(file);
+        break;
+    case WaveformExporter::Format::Binary:
+        ok = this->readBinary(file);
+        break;
+    case WaveformExporter::Format::Json:
+        ok = this->readJson(file);
+        break;
+    }
+    file.close();
+    if (m_cancelled.load())
+    {
+        emit finished(false, "导入已取消");
+        return;
+    }
+    if (!ok)
+    {
+        emit finished(false, QString("导入失败：%1").arg(m_errorString));
+        return;
+    }
+    this->flushPending(true);
+    emit progressChanged(100);
+    emit finished(true, QString("已导入 %1 个通道，%2 个数据点").arg(m_channels.size()).arg(m_importedSamples));
+}
+
+void WaveformImporter::cancel()
+{
+    m_cancelled.store(true);
+}
+
+// 私有方法
+bool WaveformImporter::readCsv(QFile& file)
+{
+    QByteArray carry;
+    bool firstLine = true;
+    while (!file.atEnd())
+    {
+        if (m_cancelled.load()) return false;
+        QByteArray buffer = carry + file.read(READ_CHUNK_SIZE);
+        const bool atEnd = file.atEnd();
+        const char* data = buffer.constData();
+        qsizetype lineStart = 0;
+        while (lineStart < buffer.size())
+        {
+            const char* newline = static_cast<const char*>(
+                std::memchr(data + lineStart, '\n', buffer.size() - lineStart));
+            // 最后一行不完整时留到下一次读取
+            if (!newline && !atEnd) break;
+            const qsizetype lineEnd = newline ? newline - data : buffer.size();
+            qsizetype contentEnd = lineEnd;
+            if (contentEnd > lineStart && data[contentEnd - 1] == '\r') --contentEnd;
+            if (contentEnd > lineStart && !this->parseCsvLine(data + lineStart, data + contentEnd))
+            {
+                // 首行解析失败视为表头
+                if (!firstLine)
+                {
+                    m_errorString = QString("无法解析的行：%1")
+                        .arg(QString::fromUtf8(data + lineStart, qMin<qsizetype>(contentEnd - lineStart, 64)));
+                    return false;
+                }
+            }
+            if (contentEnd > lineStart) firstLine = false;
+            lineStart = lineEnd + 1;
+        }
+        carry = lineStart < buffer.size() ? buffer.mid(lineStart) : QByteArray();
+        this->flushPending(false);
+        this->reportProgress(file.pos());
+    }
+    return true;
+}
+
+bool WaveformImporter::parseCsvLine(const char* begin, const char* end)
+{
+    // 格式为 channel,time_ms,value，通道名中可能含逗号，因此从行尾向前找两个分隔符
+    const char* valueSeparator = end;
+    while (valueSeparator > begin && *(valueSeparator - 1) != ',') --valueSeparator;
+    if (valueSeparator == begin) return false;
+    const char* timeSeparator = valueSeparator - 1;
+    while (timeSeparator > begin && *(timeSeparator - 1) != ',') --timeSeparator;
+    if (timeSeparator == begin) return false;
+    double timestamp = 0.0, value = 0.0;
+    if (!parseNumber(timeSeparator, valueSeparator - 1, timestamp, "")) return false;
+    if (!parseNumber(valueSeparator, end, value, "")) return false;
+    this->appendSample(QString::fromUtf8(begin, timeSeparator - 1 - begin), timestamp, value);
+    return true;
+}
+
+bool WaveformImporter::readBinary(QFile& file)
+{
+    auto readExact = [&](void* target, qint64 size)
+    {
+        if (file.read(static_cast<char*>(target), size) == size) return true;
+        m_errorString = "文件已截断";
+        return false;
+    };
+    char magic[sizeof(WaveformExporter::BINARY_MAGIC)];
+    quint32 version = 0, channelCount = 0;
+    if (!readExact(magic, sizeof(magic))) return false;
+    if (std::memcmp(magic, WaveformExporter::BINARY_MAGIC, sizeof(magic)) != 0)
+    {
+        m_errorString = "不是有效的波形二进制文件";
+        return false;
+    }
+    if (!readExact(&version, sizeof(version)) || !readExact(&channelCount, sizeof(channelCount))) return false;
+    version = qFromLittleEndian(version);
+    channelCount = qFromLittleEndian(channelCount);
+    if (version != WaveformExporter::BINARY_VERSION)
+    {
+        m_errorString = QString("不支持的文件版本：%1").arg(version);
+        return false;
+    }
+    QByteArray chunk;
+    for (quint32 c = 0; c < channelCount; ++c)
+    {
+        quint32 nameLength = 0;
+        quint64 sampleCount = 0;
+        if (!readExact(&nameLength, sizeof(nameLength))) return false;
+        nameLength = qFromLittleEndian(nameLength);
+        if (nameLength > 4096)
+        {
+            m_errorString = "通道名长度异常";
+            return false;
+        }
+        QByteArray name(nameLength, Qt::Uninitialized);
+        if (!readExact(name.data(), nameLength) || !readExact(&sampleCount, sizeof(sampleCount))) return false;
+        sampleCount = qFromLittleEndian(sampleCount);
+        const QString channelName = QString::fromUtf8(name);
+        if (!m_channels.contains(channelName))
+        {
+            m_channels.insert(channelName);
+            m_pStore->addChannel(channelName);
+            emit channelFound(channelName);
+        }
+        constexpr qsizetype pointBytes = 2 * sizeof(quint64);
+        quint64 remaining = sampleCount;
+        while (remaining > 0)
+        {
+            if (m_cancelled.load()) return false;
+            const qsizetype count = static_cast<qsizetype>(qMin<quint64>(remaining, WaveformSampleStore::BLOCK_SIZE));
+            chunk.resize(count * pointBytes);
+            if (!readExact(chunk.data(), chunk.size())) return false;
+            PendingSamples& pending = m_pending[channelName];
+            const uchar* data = reinterpret_cast<const uchar*>(chunk.constData());
+            for (qsizetype i = 0; i < count; ++i)
+            {
+                const double timestamp = std::bit_cast<double>(qFromLittleEndian<quint64>(data + i * pointBytes));
+                const double value = std::bit_cast<double>(qFromLittleEndian<quint64>(data + i * pointBytes + 8));
+                pending.timestamps.append(qMax(0.0, timestamp));
+                pending.values.append(value);
+                if (std::isfinite(timestamp)) m_maxTime = qMax(m_maxTime, timestamp);
+                if (std::isfinite(value)) m_maxAbs = qMax(m_maxAbs, std::abs(value));
+            }
+            remaining -= count;
+            this->flushPending(false);
+            this->reportProgress(file.pos());
+        }
+    }
+    return true;
+}
+
+bool WaveformImporter::readJson(QFile& file)
+{
+    QByteArray carry;
+    while (!file.atEnd())
+    {
+        if (m_cancelled.load()) return false;
+        QByteArray buffer = carry + file.read(READ_CHUNK_SIZE);
+        const qsizetype consumed = this->parseJson(buffer, file.atEnd());
+        if (consumed < 0) return false;
+        carry = buffer.mid(consumed);
+        // 单个记号不可能超过一个读取块，残留过多说明文件格式不对
+        if (carry.size() > READ_CHUNK_SIZE)
+        {
+            m_errorString = "JSON格式错误";
+            return false;
+        }
+        this->flushPending(false);
+        this->reportProgress(file.pos());
+    }
+    if (m_jsonState != JsonState::Done)
+    {
+        m_errorString = "JSON文件不完整";
+        return false;
+    }
+    return true;
+}
+
+qsizetype WaveformImporter::parseJson(const QByteArray& buffer, bool atEnd)
+{
+    const char* data = buffer.constData();
+    const qsizetype size = buffer.size();
+    qsizetype pos = 0;
+    auto fail = [this, &pos]
+    {
+        m_errorString = QString("JSON格式错误（位置 %1）").arg(pos);
+        return -1;
+    };
+    // 读取一个数字记号(null表示非有限值)；数据不足时返回false且不移动位置
+    auto readNumber = [&](double& value, bool& needMore)
+    {
+        qsizetype end = pos;
+        while (end < size && std::strchr("+-0123456789.eEnul", data[end]) && data[end] != '\0') ++end;
+        if (end == size && !atEnd)
+        {
+            needMore = true;
+            return false;
+        }
+        if (!parseNumber(data + pos, data + end, value, "null")) return false;
+        pos = end;
+        return true;
+    };
+    while (pos < size && m_jsonState != JsonState::Done)
+    {
+        const char ch = data[pos];
+        // 通道名内部的空白需要保留
+        if (m_jsonState != JsonState::Key && (ch == ' ' || ch == '\n' || ch == '\r' || ch == '\t'))
+        {
+            ++pos;
+            continue;
+        }
+        bool needMore = false;
+        switch (m_jsonState)
+        {
+        case JsonState::ObjectStart:
+            if (ch != '{') return fail();
+            m_jsonState = JsonState::KeyOrObjectEnd;
+            ++pos;
+            break;
+        case JsonState::KeyOrObjectEnd:
+            if (ch == '}') m_jsonState = JsonState::Done;
+            else if (ch == '"') m_jsonState = JsonState::Key;
+            else return fail();
+            ++pos;
+            break;
+        case JsonState::Key:
+            {
+                // 查找未转义的结束引号
+                qsizetype end = pos;
+                while (end < size && data[end] != '"') end += data[end] == '\\' ? 2 : 1;
+                if (end >= size) return pos; // 通道名不完整，留到下一次继续解析
+                const QString name = unescapeJsonString(data + pos, data + end);
+                m_jsonChannel = name;
+                if (!m_channels.contains(name))
+                {
+                    m_channels.insert(name);
+                    m_pStore->addChannel(name);
+                    emit channelFound(name);
+                }
+                m_jsonState = JsonState::Colon;
+                pos = end + 1;
+                break;
+            }
+        case JsonState::Colon:
+            if (ch != ':') return fail();
+            m_jsonState = JsonState::ArrayStart;
+            ++pos;
+            break;
+        case JsonState::ArrayStart:
+            if (ch != '[') return fail();
+            m_jsonState = JsonState::PointOrArrayEnd;
+            ++pos;
+            break;
+        case JsonState::PointOrArrayEnd:
+            if (ch == ']') m_jsonState = JsonState::AfterChannel;
+            else if (ch == '[') m_jsonState = JsonState::PointTime;
+            else return fail();
+            ++pos;
+            break;
+        case JsonState::PointStart:
+            if (ch != '[') return fail();
+            m_jsonState = JsonState::PointTime;
+            ++pos;
+            break;
+        case JsonState::PointTime:
+            if (!readNumber(m_jsonTime, needMore)) return needMore ? pos : fail();
+            m_jsonState = JsonState::PointComma;
+            break;
+        case JsonState::PointComma:
+            if (ch != ',') return fail();
+            m_jsonState = JsonState::PointValue;
+            ++pos;
+            break;
+        case JsonState::PointValue:
+            if (!readNumber(m_jsonValue, needMore)) return needMore ? pos : fail();
+            m_jsonState = JsonState::PointEnd;
+            break;
+        case JsonState::PointEnd:
+            if (ch != ']') return fail();
+            this->appendSample(m_jsonChannel, m_jsonTime, m_jsonValue);
+            m_jsonState = JsonState::AfterPoint;
+            ++pos;
+            break;
+        case JsonState::AfterPoint:
+            if (ch == ',') m_jsonState = JsonState::PointStart;
+            else if (ch == ']') m_jsonState = JsonState::AfterChannel;
+            else return fail();
+            ++pos;
+            break;
+        case JsonState::AfterChannel:
+            if (ch == ',') m_jsonState = JsonState::KeyOrObjectEnd;
+            else if (ch == '}') m_jsonState = JsonState::Done;
+            else return fail();
+            ++pos;
+            break;
+        case JsonState::Done:
+            break;
+        }
+    }
+    return pos;
+}
+
+void WaveformImporter::appendSample(const QString& name, double timestamp, double value)
+{
+    if (!m_channels.contains(name))
+    {
+        m_channels.insert(name);
+        m_pStore->addChannel(name);
+        emit channelFound(name);
+    }
+    PendingSamples& pending = m_pending[name];
+    // 确保时间戳非负
+    pending.timestamps.append(qMax(0.0, timestamp));
+    pending.values.append(value);
+    if (std::isfinite(timestamp)) m_maxTime = qMax(m_maxTime, timestamp);
+    if (std::isfinite(value)) m_maxAbs = qMax(m_maxAbs, std::abs(value));
+}
+
+void WaveformImporter::flushPending(bool force)
+{
+    for (auto it = m_pending.begin(); it != m_pending.end(); ++it)
+    {
+        PendingSamples& pending = it.value();
+        if (pending.timestamps.isEmpty()) continue;
+        if (!force && pending.timestamps.size() < WaveformSampleStore::BLOCK_SIZE / 4) continue;
+        m_pStore->appendSamples(it.key(), pending.timestamps.constData(), pending.values.constData(),
+                                pending.timestamps.size());
+        m_importedSamples += pending.timestamps.size();
+        pending.timestamps.resize(0);
+        pending.values.resize(0);
+    }
+}
+
+void WaveformImporter::reportProgress(qint64 position)
+{
+    if (m_fileSize <= 0) return;
+    const int percent = static_cast<int>(position * 100 / m_fileSize);
+    if (percent == m_lastPercent) return;
+    m_lastPercent = percent;
+    // 每推进一个百分点就把缓存写入存储，让界面尽早显示概览
+    this->flushPending(true);
+    emit progressChanged(percent);
+    emit dataRangeChanged(m_maxTime, m_maxAbs);
+}
+
+bool WaveformImporter::parseNumber(const char* begin, const char* end, double& value, const char* nullText)
+{
+    while (begin < end && (*begin == ' ' || *begin == '\t' || *begin == '"')) ++begin;
+    while (end > begin && (*(end - 1) == ' ' || *(end - 1) == '\t' || *(end - 1) == '"')) --end;
+    if (nullText && static_cast<size_t>(end - begin) == std::strlen(nullText)
+        && std::memcmp(begin, nullText, end - begin) == 0)
+    {
+        value = std::numeric_limits<double>::quiet_NaN();
+        return true;
+    }
+    if (begin < end && *begin == '+') ++begin;
+    if (begin == end) return false;
+    auto result = std::from_chars(begin, end, value);
+    return result.ec == std::errc() && result.ptr == end;
+}
+
+QString WaveformImporter::unescapeJsonString(const char* begin, const char* end)
+{
+    // 快速路径：不含转义字符时直接解码
+    if (!std::memchr(begin, '\\', end - begin)) return QString::fromUtf8(begin, end - begin);
+    QByteArray utf8;
+    QString result;
+    auto flushUtf8 = [&]
+    {
+        result += QString::fromUtf8(utf8);
+        utf8.clear();
+    };
+    for (const char* p = begin; p < end; ++p)
+    {
+        if (*p != '\\' || p + 1 >= end)
+        {
+            utf8.append(*p);
+            continue;
+        }
+        const char escape = *++p;
+        switch (escape)
+        {
+        case 'b': utf8.append('\b'); break;
+        case 'f': utf8.append('\f'); break;
+        case 'n': utf8.append('\n'); break;
+        case 'r': utf8.append('\r'); break;
+        case 't': utf8.append('\t'); break;
+        case 'u':
+            {
+                // \uXXXX逐个追加UTF-16码元，代理对会在QString中自然组合
+                ushort code = 0;
+                auto parsed = std::from_chars(p + 1, qMin(p + 5, end), code, 16);
+                if (parsed.ec != std::errc() || parsed.ptr != p + 5)
+                {
+                    utf8.append('u');
+                    break;
+                }
+                flushUtf8();
+                result += QChar(code);
+                p += 4;
+                break;
+            }
+        default: utf8.append(escape); break; // \" \\ \/
+        }
+    }
+    flushUtf8();
+    return result;
+}
@@ -0,0 +1,450 @@
+/**
+  ******************************************************************************
+  * @file           : WaveformSampleStore.cpp
+  * @author         : wangxiangyu
+  * @brief          : 波形采样数据存储实现
+  * @attention      : None
+  * @date           : 2026/10/19
+  ******************************************************************************
+  */
+
+#include "utils/WaveformSampleStore.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// 静态成员定义
+WaveformSampleStore* WaveformSampleStore::m_pInstance = nullptr;
+QMutex WaveformSampleStore::m_mutex;
+
+// 静态工厂方法/单例方法
+WaveformSampleStore* WaveformSampleStore::getInstance()
+{
+    if (m_pInstance == nullptr)
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_pInstance == nullptr) m_pInstance = new WaveformSampleStore();
+    }
+    return m_pInstance;
+}
+
+// Block
+const double* WaveformSampleStore::Block::timeData() const
+{
+    return mapping ? reinterpret_cast<const double*>(mapping) : timestamps.constData();
+}
+
+const double* WaveformSampleStore::Block::valueData() const
+{
+    return mapping ? reinterpret_cast<const double*>(mapping) + BLOCK_SIZE : values.constData();
+}
+
+// 通道管理
+void WaveformSampleStore::addChannel(const QString& name)
+{
+    QWriteLocker locker(&m_lock);
+    if (!m_channels.contains(name)) m_channels.insert(name, ChannelData());
+}
+
+void WaveformSampleStore::removeChannel(const QString& name)
+{
+    QWriteLocker locker(&m_lock);
+    auto it = m_channels.find(name);
+    if (it == m_channels.end()) return;
+    this->releaseChannel(*it);
+    m_channels.erase(it);
+}
+
+void WaveformSampleStore::clearChannel(const QString& name)
+{
+    QWriteLocker locker(&m_lock);
+    auto it = m_channels.find(name);
+    if (it == m_channels.end()) return;
+    this->releaseChannel(*it);
+}
+
+void WaveformSampleStore::clearAll()
+{
+    QWriteLocker locker(&m_lock);
+    for (ChannelData& channel : m_channels) this->releaseChannel(channel);
+    m_channels.clear();
+}
+
+bool WaveformSampleStore::hasChannel(const QString& name) const
+{
+    QReadLocker locker(&m_lock);
+    return m_channels.contains(name);
+}
+
+QStringList WaveformSampleStore::getChannelNames() const
+{
+    QReadLocker locker(&m_lock);
+    return m_channels.keys();
+}
+
+// 数据写入
+void WaveformSampleStore::appendSamples(const QString& name, const double* timestamps, const double* values,
+                                        qsizetype count)
+{
+    if (count <= 0) return;
+    QWriteLocker locker(&m_lock);
+    ChannelData& channel = m_channels[name];
+    double lastTime = channel.blocks.isEmpty() ? 0.0 : channel.blocks.last().endTime;
+    for (qsizetype i = 0; i < count; ++i)
+    {
+        if (channel.blocks.isEmpty() || channel.blocks.last().count == BLOCK_SIZE)
+        {
+            Block block;
+            block.timestamps.reserve(BLOCK_SIZE);
+            block.values.reserve(BLOCK_SIZE);
+            channel.blocks.append(std::move(block));
+        }
+        Block& block = channel.blocks.last();
+        // 查询依赖二分查找，时间戳必须非负且单调不减
+        lastTime = std::max(lastTime, timestamps[i]);
+        const double value = values[i];
+        if (block.count == 0)
+        {
+            block.startTime = lastTime;
+            block.minValue = block.maxValue = value;
+        }
+        else
+        {
+            if (value < block.minValue) block.minValue = value;
+            if (value > block.maxValue) block.maxValue = value;
+        }
+        block.endTime = lastTime;
+        block.timestamps.append(lastTime);
+        block.values.append(value);
+        ++block.count;
+        ++channel.sampleCount;
+        channel.pyramid.append(lastTime, value);
+    }
+    if (m_spillEnabled) this->spillBlocks(channel);
+}
+
+void WaveformSampleStore::setSpillEnabled(bool enabled)
+{
+    QWriteLocker locker(&m_lock);
+    m_spillEnabled = enabled;
+}
+
+bool WaveformSampleStore::isSpillEnabled() const
+{
+    QReadLocker locker(&m_lock);
+    return m_spillEnabled;
+}
+
+// 数据查询
+qsizetype WaveformSampleStore::getSampleCount(const QString& name) const
+{
+    QReadLocker locker(&m_lock);
+    auto it = m_channels.constFind(name);
+    return it == m_channels.constEnd() ? 0 : it->sampleCount;
+}
+
+qsizetype WaveformSampleStore::getSampleCount(const QString& name, double startTime, double endTime) const
+{
+    QReadLocker locker(&m_lock);
+    auto it = m_channels.constFind(name);
+    if (it == m_channels.constEnd()) return 0;
+    qsizetype first = 0, last = 0;
+    findRange(*it, startTime, endTime, first, last);
+    return last - first;
+}
+
+bool WaveformSampleStore::getTimeRange(const QString& name, double& minTime, double& maxTime) const
+{
+    QReadLocker locker(&m_lock);
+    auto it = m_channels.constFind(name);
+    if (it == m_channels.constEnd() || it->sampleCount == 0) return false;
+    minTime = it->blocks.first().startTime;
+    maxTime = it->blocks.last().endTime;
+    return true;
+}
+
+bool WaveformSampleStore::getValueRange(const QString& name, double startTime, double endTime, double& minValue,
+                                        double& maxValue) const
+{
+    QReadLocker locker(&m_lock);
+    auto it = m_channels.constFind(name);
+    if (it == m_channels.constEnd()) return false;
+    qsizetype first = 0, last = 0;
+    findRange(*it, startTime, endTime, first, last);
+    if (first >= last) return false;
+    minValue = std::numeric_limits<double>::max();
+    maxValue = std::numeric_limits<double>::lowest();
+    for (qsizetype b = first / BLOCK_SIZE; b <= (last - 1) / BLOCK_SIZE; ++b)
+    {
+        const Block& block = it->blocks[b];
+        const qsizetype blockFirst = b * BLOCK_SIZE;
+        const qsizetype from = qMax(first, blockFirst) - blockFirst;
+        const qsizetype to = qMin(last, blockFirst + block.count) - blockFirst;
+        // 整块落在区间内时直接使用块的统计值
+        if (from == 0 && to == block.count)
+        {
+            minValue = qMin(minValue, block.minValue);
+            maxValue = qMax(maxValue, block.maxValue);
+            continue;
+        }
+        auto [minIt, maxIt] = std::minmax_element(block.valueData() + from, block.valueData() + to);
+        minValue = qMin(minValue, *minIt);
+        maxValue = qMax(maxValue, *maxIt);
+    }
+    return true;
+}
+
+bool WaveformSampleStore::getValueAt(const QString& name, double time, double& sampleTime, double& value) const
+{
+    QReadLocker locker(&m_lock);
+    auto it = m_channels.constFind(name);
+    if (it == m_channels.constEnd() || it->sampleCount == 0) return false;
+    qsizetype index = qMin(lowerBound(*it, time), it->sampleCount - 1);
+    auto timeAt = [&](qsizetype i) { return it->blocks[i / BLOCK_SIZE].timeData()[i % BLOCK_SIZE]; };
+    // 取前后两个点中离目标时间更近的一个
+    if (index > 0 && std::abs(timeAt(index - 1) - time) < std::abs(timeAt(index) - time)) --index;
+    sampleTime = timeAt(index);
+    value = it->blocks[index / BLOCK_SIZE].valueData()[index % BLOCK_SIZE];
+    return true;
+}
+
+QVector<WaveformColumn> WaveformSampleStore::queryColumns(const QString& name, double startTime, double endTime,
+                                                          int columns) const
+{
+    QVector<WaveformColumn> result(qMax(columns, 0));
+    if (columns <= 0 || endTime <= startTime) return result;
+    QReadLocker locker(&m_lock);
+    auto it = m_channels.constFind(name);
+    if (it == m_channels.constEnd()) return result;
+    qsizetype first = 0, last = 0;
+    findRange(*it, startTime, endTime, first, last);
+    if (first >= last) return result;
+    const double columnWidth = (endTime - startTime) / columns;
+    auto accumulate = [&](double time, double minValue, double maxValue, double firstValue, double lastValue)
+    {
+        int column = std::clamp(static_cast<int>((time - startTime) / columnWidth), 0, columns - 1);
+        WaveformColumn& cell = result[column];
+        if (!cell.valid)
+        {
+            cell.minValue = minValue;
+            cell.maxValue = maxValue;
+            cell.firstValue = firstValue;
+            cell.valid = true;
+        }
+        else
+        {
+            if (minValue < cell.minValue) cell.minValue = minValue;
+            if (maxValue > cell.maxValue) cell.maxValue = maxValue;
+        }
+        cell.lastValue = lastValue;
+    };
+    auto accumulateRaw = [&](qsizetype from, qsizetype to)
+    {
+        forEachSegment(*it, from, to, [&](const double* timestamps, const double* values, qsizetype count)
+        {
+            for (qsizetype i = 0; i < count; ++i)
+                accumulate(timestamps[i], values[i], values[i], values[i], values[i]);
+        });
+    };
+    // 每列至少覆盖两个桶时才使用金字塔，保证桶不会跨越太多像素列
+    const qsizetype samplesPerColumn = (last - first) / columns;
+    const int level = it->pyramid.selectLevel(samplesPerColumn / 2);
+    if (level < 0)
+    {
+        accumulateRaw(first, last);
+        return result;
+    }
+    // 区间两端不足一个整桶的部分直接读原始点，中间的整桶读金字塔
+    const qsizetype bucketSize = WaveformPyramid::getBucketSize(level);
+    const qsizetype firstBucket = (first + bucketSize - 1) / bucketSize;
+    const qsizetype lastBucket = last / bucketSize;
+    if (firstBucket >= lastBucket)
+    {
+        accumulateRaw(first, last);
+        return result;
+    }
+    accumulateRaw(first, firstBucket * bucketSize);
+    const QVector<WaveformBucket>& buckets = it->pyramid.getBuckets(level);
+    for (qsizetype b = firstBucket; b < lastBucket; ++b)
+    {
+        const WaveformBucket& bucket = buckets[b];
+        accumulate(bucket.startTime, bucket.minValue, bucket.maxValue, bucket.firstValue, bucket.lastValue);
+    }
+    accumulateRaw(lastBucket * bucketSize, last);
+    return result;
+}
+
+void WaveformSampleStore::querySamples(const QString& name, double startTime, double endTime,
+                                       QVector<double>& timestamps, QVector<double>& values) const
+{
+    timestamps.clear();
+    values.clear();
+    QReadLocker locker(&m_lock);
+    auto it = m_channels.constFind(name);
+    if (it == m_channels.constEnd()) return;
+    qsizetype first = 0, last = 0;
+    findRange(*it, startTime, endTime, first, last);
+    // 向两侧各扩展一个点，保证曲线能连到视图边界
+    first = qMax<qsizetype>(0, first - 1);
+    last = qMin<qsizetype>(it->sampleCount, last + 1);
+    if (first >= last) return;
+    copyRange(*it, first, last, timestamps, values);
+}
+
+void WaveformSampleStore::queryDisplaySamples(const QString& name, double startTime, double endTime,
+                                              qsizetype maxPoints, QVector<double>& timestamps,
+                                              QVector<double>& values) const
+{
+    QVector<double> rawTimestamps, rawValues;
+    this->querySamples(name, startTime, endTime, rawTimestamps, rawValues);
+    if (rawTimestamps.size() <= maxPoints)
+    {
+        timestamps.swap(rawTimestamps);
+        values.swap(rawValues);
+        return;
+    }
+    WaveformDecimator::lttb(rawTimestamps.constData(), rawValues.constData(), rawTimestamps.size(), maxPoints,
+                            timestamps, values);
+}
+
+qsizetype WaveformSampleStore::readSamples(const QString& name, qsizetype firstIndex, qsizetype maxCount,
+                                           QVector<double>& timestamps, QVector<double>& values) const
+{
+    timestamps.clear();
+    values.clear();
+    QReadLocker locker(&m_lock);
+    auto it = m_channels.constFind(name);
+    if (it == m_channels.constEnd() || firstIndex < 0 || maxCount <= 0) return 0;
+    const qsizetype last = qMin(it->sampleCount, firstIndex + maxCount);
+    if (firstIndex >= last) return 0;
+    copyRange(*it, firstIndex, last, timestamps, values);
+    return last - firstIndex;
+}
+
+// 私有方法
+void WaveformSampleStore::findRange(const ChannelData& channel, double startTime, double endTime, qsizetype& first,
+                                    qsizetype& last)
+{
+    first = lowerBound(channel, startTime);
+    last = upperBound(channel, endTime);
+}
+
+qsizetype WaveformSampleStore::lowerBound(const ChannelData& channel, double time)
+{
+    // 先按块的结束时间定位到块，再在块内二分
+    auto blockIt = std::lower_bound(channel.blocks.cbegin(), channel.blocks.cend(), time,
+                                    [](const Block& block, double t) { return block.endTime < t; });
+    if (blockIt == channel.blocks.cend()) return channel.sampleCount;
+    const qsizetype blockIndex = blockIt - channel.blocks.cbegin();
+    const double* timestamps = blockIt->timeData();
+    return blockIndex * BLOCK_SIZE + (std::lower_bound(timestamps, timestamps + blockIt->count, time) - timestamps);
+}
+
+qsizetype WaveformSampleStore::upperBound(const ChannelData& channel, double time)
+{
+    auto blockIt = std::upper_bound(channel.blocks.cbegin(), channel.blocks.cend(), time,
+                                    [](double t, const Block& block) { return t < block.endTime; });
+    if (blockIt == channel.blocks.cend()) return channel.sampleCount;
+    const qsizetype blockIndex = blockIt - channel.blocks.cbegin();
+    const double* timestamps = blockIt->timeData();
+    return blockIndex * BLOCK_SIZE + (std::upper_bound(timestamps, timestamps + blockIt->count, time) - timestamps);
+}
+
+template <typename Func>
+void WaveformSampleStore::forEachSegment(const ChannelData& channel, qsizetype first, qsizetype last, Func func)
+{
+    while (first < last)
+    {
+        const Block& block = channel.blocks[first / BLOCK_SIZE];
+        const qsizetype offset = first % BLOCK_SIZE;
+        const qsizetype count = qMin(last - first, block.count - offset);
+        func(block.timeData() + offset, block.valueData() + offset, count);
+        first += count;
+    }
+}
+
+void WaveformSampleStore::copyRange(const ChannelData& channel, qsizetype first, qsizetype last,
+                                    QVector<double>& timestamps, QVector<double>& values)
+{
+    timestamps.reserve(last - first);
+    values.reserve(last - first);
+    forEachSegment(channel, first, last, [&](const double* t, const double* v, qsizetype count)
+    {
+        timestamps.append(t, count);
+        values.append(v, count);
+    });
+}
+
+void WaveformSampleStore::spillBlocks(ChannelData& channel)
+{
+    // 最后一块仍在写入，不参与溢出；其前面保留MAX_RESIDENT_BLOCKS个已写满的块在内存中
+    const qsizetype spillEnd = channel.blocks.size() - 1 - MAX_RESIDENT_BLOCKS;
+    for (qsizetype b = channel.firstResidentBlock; b < spillEnd; ++b)
+    {
+        Block& block = channel.blocks[b];
+        if (!m_spillFile.isOpen())
+        {
+            m_spillFile.setFileTemplate(QDir::tempPath() + "/serial_debug_tool_waveform_XXXXXX.bin");
+            if (!m_spillFile.open())
+            {
+                qWarning() << "Failed to open waveform spill file, keeping samples in memory:"
+                    << m_spillFile.errorString();
+                m_spillEnabled = false;
+                return;
+            }
+        }
+        const qint64 blockBytes = BLOCK_SIZE * qint64(sizeof(double));
+        // 优先复用已清除通道留下的位置，避免文件只增不减
+        const bool isReused = !m_freeSpillSlots.isEmpty();
+        const qint64 offset = isReused ? m_freeSpillSlots.last() : m_spillFileSize;
+        m_spillFile.seek(offset);
+        if (m_spillFile.write(reinterpret_cast<const char*>(block.timestamps.constData()), blockBytes) != blockBytes
+            || m_spillFile.write(reinterpret_cast<const char*>(block.values.constData()), blockBytes) != blockBytes
+            || !m_spillFile.flush())
+        {
+            qWarning() << "Failed to write waveform spill file, keeping samples in memory:"
+                << m_spillFile.errorString();
+            m_spillEnabled = false;
+            return;
+        }
+        uchar* mapping = m_spillFile.map(offset, blockBytes * 2);
+        if (!mapping)
+        {
+            qWarning() << "Failed to map waveform spill file, keeping samples in memory:"
+                << m_spillFile.errorString();
+            m_spillEnabled = false;
+            return;
+        }
+        // 写入并映射成功后才占用该位置
+        if (isReused) m_freeSpillSlots.removeLast();
+        else m_spillFileSize += blockBytes * 2;
+        ++m_spilledBlockCount;
+        block.mapping = mapping;
+        block.spillOffset = offset;
+        channel.firstResidentBlock = b + 1;
+        block.timestamps = QVector<double>();
+        block.values = QVector<double>();
+    }
+}
+
+void WaveformSampleStore::releaseChannel(ChannelData& channel)
+{
+    for (Block& block : channel.blocks)
+    {
+        if (!block.mapping) continue;
+        m_spillFile.unmap(block.mapping);
+        m_freeSpillSlots.append(block.spillOffset);
+        --m_spilledBlockCount;
+    }
+    channel.blocks.clear();
+    channel.sampleCount = 0;
+    channel.firstResidentBlock = 0;
+    channel.pyramid.clear();
+    // 所有溢出块都已释放时截断文件，回收磁盘空间
+    if (m_spilledBlockCount == 0 && m_spillFileSize > 0)
+    {
+        m_spillFile.resize(0);
+        m_spillFileSize = 0;
+        m_freeSpillSlots.clear();
+    }
+}